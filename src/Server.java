@@ -0,0 +1,132 @@
+import constructor.Result;
+import constructor.Session;
+
+import java.io.BufferedInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.io.PrintStream;
+import java.nio.charset.StandardCharsets;
+import java.util.Arrays;
+
+public class Server {
+    //Attributes
+    private static final int MAX_PAYLOAD = 64 * 1024 * 1024;
+    private Singularity singularity;
+    private Session session;
+
+    //Constructor
+    public Server () {
+        singularity = new Singularity();
+        session = new Session();
+        singularity.setSession(session);
+    }
+
+    //Methods
+    //Framed protocol: a request is a header line followed by a payload of the given byte length
+    //  PATH <length>           payload is the path of a source file
+    //  SOURCE <name> <length>  payload is the source text, name carries its extension
+    //  QUIT 0
+    //and a reply is "OK <length>" or "ERROR <length>" followed by the report or the error message.
+    //A header without a valid length loses the framing, so it is answered with ERROR and the
+    //connection is closed. The parser and the NuSMV session stay warm between requests
+    public void serve (InputStream in, OutputStream out) throws IOException {
+        InputStream input = new BufferedInputStream(in);
+        try {
+            String header;
+            while ((header = readLine(input)) != null) {
+                if (header.isEmpty()) {
+                    continue;
+                }
+                String[] fields = header.split(" ");
+                int length = parseLength(fields[fields.length - 1]);
+                if (length == -1) {
+                    reply(out, "ERROR", "Malformed header: " + header);
+                    break;
+                }
+                String payload = readPayload(input, length);
+                if (fields[0].equals("QUIT")) {
+                    break;
+                }
+                try {
+                    Result result;
+                    if (fields[0].equals("PATH") && fields.length == 2) {
+                        result = singularity.analyzeFile(payload, false);
+                    } else if (fields[0].equals("SOURCE") && fields.length == 3) {
+                        result = singularity.analyze(payload, fields[1], false);
+                    } else {
+                        reply(out, "ERROR", "Unknown request: " + header);
+                        continue;
+                    }
+                    if (result.isRejected()) {
+                        reply(out, "ERROR", result.getError());
+                    } else {
+                        reply(out, "OK", result.getReport());
+                    }
+                } catch (Exception e) {
+                    reply(out, "ERROR", String.valueOf(e));
+                }
+            }
+        } finally {
+            session.close();
+        }
+    }
+
+    public static void main (String[] args) throws IOException {
+        if (args.length > 0 && args[0].equals("--serve")) {
+            //Anything the pipeline prints would corrupt the protocol, so it goes to stderr
+            PrintStream out = System.out;
+            System.setOut(System.err);
+            new Server().serve(System.in, out);
+            return;
+        }
+        new Singularity().run(Arrays.asList(args), false, result -> { });
+    }
+
+    //Private Methods
+    private String readLine (InputStream input) throws IOException {
+        ByteArrayOutputStream line = new ByteArrayOutputStream();
+        int read;
+        while ((read = input.read()) != -1 && read != '\n') {
+            line.write(read);
+        }
+        if (read == -1 && line.size() == 0) {
+            return null;
+        }
+        return line.toString(StandardCharsets.UTF_8.name()).trim();
+    }
+
+    //Returns -1 unless the length is a number from 0 to MAX_PAYLOAD
+    private int parseLength (String field) {
+        try {
+            int length = Integer.parseInt(field);
+            if (length >= 0 && length <= MAX_PAYLOAD) {
+                return length;
+            }
+        } catch (NumberFormatException e) {
+            //Not a length
+        }
+        return -1;
+    }
+
+    private String readPayload (InputStream input, int length) throws IOException {
+        byte[] payload = new byte[length];
+        int offset = 0;
+        while (offset < length) {
+            int read = input.read(payload, offset, length - offset);
+            if (read == -1) {
+                throw new IOException("Truncated payload");
+            }
+            offset += read;
+        }
+        return new String(payload, StandardCharsets.UTF_8);
+    }
+
+    private void reply (OutputStream out, String status, String body) throws IOException {
+        byte[] bytes = body.getBytes(StandardCharsets.UTF_8);
+        out.write((status + " " + bytes.length + "\n").getBytes(StandardCharsets.UTF_8));
+        out.write(bytes);
+        out.flush();
+    }
+}
@@ -1,40 +1,281 @@
-import global.exception.ReaderException;
+import global.tools.Configuration;
 import global.tools.FileName;
+import global.tools.IoMode;
+import global.tools.Output;
 import global.tools.Reset;
-import reader.Reader;
+import org.antlr.v4.runtime.CharStream;
+import org.antlr.v4.runtime.CharStreams;
+import org.antlr.v4.runtime.Token;
+import org.antlr.v4.runtime.tree.ParseTree;
+import reader.StagedReader;
+import reader.TokenReader;
 import constructor.Constructor;
+import constructor.Result;
+import constructor.Session;
+import constructor.Step;
 import extractor.Extractor;
 import generator.Generator;
+import generator.model.Model;
+import global.structure.State;
+import global.structure.Transition;
+import global.tools.Statistics;
+
+import java.io.IOException;
+import java.io.InputStream;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ArrayBlockingQueue;
+import java.util.concurrent.BlockingQueue;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.function.Consumer;
 
 public class Singularity {
     //Attributes
-    private Reader reader;
+    //Extraction and generation share process-wide singletons, so only one analysis runs at a time
+    private static final Object ANALYSIS = new Object();
+    private StagedReader reader;
+    private TokenReader tokenReader;
     private Extractor extractor;
     private Constructor constructor;
     private Generator generator;
     private FileName fileName;
     private Reset reset;
+    private Configuration configuration;
+    private Statistics statistics;
+    private Session session;
 
     //Constructor
     public Singularity () {
-        reader = new Reader();
+        reader = new StagedReader();
+        tokenReader = new TokenReader();
         extractor = new Extractor();
         constructor = new Constructor();
         generator = new Generator();
         fileName = FileName.getInstance();
         reset = new Reset();
+        configuration = Configuration.getInstance();
+        statistics = Statistics.getInstance();
     }
 
     //Methods
     public void run (String input, boolean debug) {
-        fileName.setFileName(input);
         try {
-            extractor.extract(reader.read(input), debug);
-            constructor.build(generator.generate(extractor.getStates(), extractor.getTransitions()));
-        } catch (ReaderException exception) {
+            process(CharStreams.fromFileName(input), input, debug, configuration.getOutput());
+        } catch (IOException exception) {
             exception.printStackTrace();
+            reset.masterReset();
+        }
+    }
+
+    //Batch entry point, run as a pipeline. Extraction and generation share the extractor state and
+    //the statistics, so they run one file at a time on the calling thread, while the checking
+    //workers run NuSMV on the files already generated. A single constructor hands each Result to the
+    //consumer in input order, so the statistics file keeps the order of a sequential run and no
+    //Result is kept once the consumer returns. The batch parser counters start from zero on each call
+    public void run (List<String> inputs, boolean debug, Consumer<Result> consumer) {
+        synchronized (ANALYSIS) {
+            statistics.resetBatch();
+        }
+        int checkers = Math.max(1, configuration.getCheckWorkers());
+        int capacity = Math.max(1, configuration.getQueueCapacity());
+        BlockingQueue<Work> generated = new ArrayBlockingQueue<>(capacity);
+        BlockingQueue<Work> checked = new ArrayBlockingQueue<>(capacity);
+        ExecutorService executor = Executors.newFixedThreadPool(checkers + 1);
+        try {
+            for (int i = 0; i < checkers; i++) {
+                executor.submit(() -> check(generated, checked));
+            }
+            Future<?> constructed = executor.submit(() -> construct(checked, checkers, consumer));
+            Output output = configuration.getOutput();
+            int index = 0;
+            for (String input : inputs) {
+                Work work = null;
+                synchronized (ANALYSIS) {
+                    try {
+                        work = prepare(CharStreams.fromFileName(input), input, debug, output);
+                    } catch (Exception exception) {
+                        exception.printStackTrace();
+                    } finally {
+                        reset.masterReset();
+                    }
+                }
+                if (work != null) {
+                    work.index = index++;
+                    generated.put(work);
+                }
+            }
+            for (int i = 0; i < checkers; i++) {
+                Work end = new Work();
+                end.end = true;
+                generated.put(end);
+            }
+            constructed.get();
+        } catch (Exception exception) {
+            exception.printStackTrace();
+        } finally {
+            executor.shutdownNow();
+        }
+    }
+
+    //Models are checked in the session's NuSMV process instead of one process per run
+    public void setSession (Session session) {
+        this.session = session;
+        constructor.setSession(session);
+    }
+
+    //In-memory entry points: the model goes to NuSMV through a pipe and no file is written
+    //unless persist is set, in which case the configured I/O mode and artifacts apply.
+    //The name only has to carry an extension; it is used for persisted files and the report.
+    //Concurrent calls are safe and run one after the other
+    public Result analyze (String source, String name, boolean persist) {
+        return analyze(CharStreams.fromString(source, name), name, persist);
+    }
+
+    public Result analyzeFile (String path, boolean persist) throws IOException {
+        return analyze(CharStreams.fromFileName(path), path, persist);
+    }
+
+    public Result analyze (InputStream stream, String name, boolean persist) throws IOException {
+        return analyze(CharStreams.fromStream(stream), name, persist);
+    }
+
+    //Private Methods
+    private Result analyze (CharStream stream, String name, boolean persist) {
+        Output output = configuration.getOutput();
+        if (!persist) {
+            //A session reads models from files, so they go to tmpfs rather than through a pipe
+            output = new Output(session != null ? IoMode.TMPFS : IoMode.PIPE, "");
+        }
+        return process(stream, name, false, output);
+    }
+
+    private Result process (CharStream stream, String name, boolean debug, Output output) {
+        synchronized (ANALYSIS) {
+            try {
+                Work work = prepare(stream, name, debug, output);
+                if (work.error != null) {
+                    return rejected(work);
+                }
+                Result result = constructor.build(work.model);
+                result.setStates(work.states);
+                result.setTransitions(work.transitions);
+                return result;
+            } finally {
+                reset.masterReset();
+            }
         }
-        reset.masterReset();
+    }
+
+    //Extracts and generates the model of a file; the caller resets the shared state afterwards.
+    //Input the parser rejects is neither extracted nor checked, and only carries the error
+    private Work prepare (CharStream stream, String name, boolean debug, Output output) {
+        fileName.setFileName(name);
+        Work work = new Work();
+        List<Token> tokens = null;
+        if (configuration.isLexerOnly()) {
+            tokens = tokenReader.read(stream);
+            stream.seek(0);
+        }
+        if (tokens != null) {
+            extractor.extract(tokens, debug, output);
+        } else {
+            ParseTree tree = reader.read(stream);
+            if (tree == null) {
+                work.error = name + ": " + reader.getError();
+                System.err.println("Rejected " + work.error);
+                return work;
+            }
+            extractor.extract(tree, debug, output);
+        }
+        work.model = generator.generate(extractor.getStates(), extractor.getTransitions(), extractor.getOwners(), output);
+        work.states = new ArrayList<>(extractor.getStates());
+        work.transitions = new ArrayList<>(extractor.getTransitions());
+        work.statistics = statistics.copy();
+        return work;
+    }
+
+    //Checking worker: the end of the batch is passed on to the constructor
+    private void check (BlockingQueue<Work> generated, BlockingQueue<Work> checked) {
+        try {
+            Work work;
+            while (!(work = generated.take()).end) {
+                if (work.error != null) {
+                    checked.put(work);
+                    continue;
+                }
+                try {
+                    work.counterexamples = constructor.check(work.model);
+                } catch (Exception exception) {
+                    exception.printStackTrace();
+                    work.counterexamples = new ArrayList<>();
+                }
+                checked.put(work);
+            }
+            checked.put(work);
+        } catch (InterruptedException exception) {
+            Thread.currentThread().interrupt();
+        }
+    }
+
+    private Void construct (BlockingQueue<Work> checked, int checkers, Consumer<Result> consumer) throws InterruptedException {
+        Map<Integer, Work> pending = new HashMap<>();
+        int next = 0;
+        int ended = 0;
+        while (ended < checkers) {
+            Work work = checked.take();
+            if (work.end) {
+                ended ++;
+                continue;
+            }
+            pending.put(work.index, work);
+            //Keeps draining on failure, so the workers never block on a full queue
+            while ((work = pending.remove(next)) != null) {
+                next ++;
+                try {
+                    consumer.accept(work.error != null ? rejected(work) : constructed(work));
+                } catch (Exception exception) {
+                    exception.printStackTrace();
+                }
+            }
+        }
+        return null;
+    }
+
+    private Result constructed (Work work) {
+        Result result;
+        try {
+            result = constructor.construct(work.model, work.counterexamples, work.statistics);
+        } catch (Exception exception) {
+            exception.printStackTrace();
+            result = new Result();
+            result.setModel(work.model);
+            result.setCounterexamples(work.counterexamples);
+        }
+        result.setStates(work.states);
+        result.setTransitions(work.transitions);
+        return result;
+    }
+
+    private Result rejected (Work work) {
+        Result result = new Result();
+        result.setError(work.error);
+        return result;
+    }
+
+    //A file on its way through the batch pipeline
+    private static class Work {
+        private int index;
+        private Model model;
+        private List<State> states;
+        private List<Transition> transitions;
+        private Statistics statistics;
+        private List<List<Step>> counterexamples;
+        private String error;
+        private boolean end;
     }
 
 }
@@ -1,35 +1,131 @@
 package constructor;
 
+import generator.model.Model;
 import global.structure.Event;
 import global.structure.State;
 import global.structure.Transition;
-import global.tools.FileName;
+import global.tools.Configuration;
+import global.tools.Output;
 import global.tools.Statistics;
 
 import java.io.*;
 import java.util.ArrayList;
+import java.util.BitSet;
+import java.util.Collections;
 import java.util.List;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.Semaphore;
 
 public class Constructor {
 
     //Attributes
-    private FileName fileName;
     private Filter filter;
     private Statistics statistics;
+    private Configuration configuration;
+    private Session session;
+    private Semaphore processes;
 
     //Constructor
     public Constructor() {
-        fileName = FileName.getInstance();
         filter = new Filter();
         statistics = Statistics.getInstance();
+        configuration = Configuration.getInstance();
+        processes = new Semaphore(Math.max(1, configuration.getWorkers()));
     }
 
     //Public Methods
-    public void build(List<State> states) {
+    //With a session, models written to a file are checked in its warm NuSMV process
+    public void setSession(Session session) {
+        this.session = session;
+    }
+
+    public Result build(Model model) {
+        return construct(model, check(model), statistics);
+    }
+
+    //Runs NuSMV on the model, or on each of its parts, and returns every counterexample found
+    public List<List<Step>> check(Model model) {
+        List<Model> models = model.getParts();
+        if (models.isEmpty()) {
+            models = Collections.singletonList(model);
+        }
+        List<List<Step>> counterexamples = new ArrayList<>();
+        if (models.size() == 1 || configuration.getWorkers() <= 1 || session != null) {
+            for (Model checked : models) {
+                counterexamples.addAll(checkPart(checked));
+            }
+        } else {
+            //Parts are independent models; their counterexamples are gathered in part order
+            ExecutorService executor = Executors.newFixedThreadPool(Math.min(configuration.getWorkers(), models.size()));
+            List<Future<List<List<Step>>>> results = new ArrayList<>();
+            for (Model checked : models) {
+                results.add(executor.submit(() -> checkPart(checked)));
+            }
+            try {
+                for (Future<List<List<Step>>> result : results) {
+                    counterexamples.addAll(result.get());
+                }
+            } catch (Exception e) {
+                e.printStackTrace();
+            } finally {
+                executor.shutdown();
+            }
+        }
+        return counterexamples;
+    }
+
+    //Reports the counterexamples of a checked model with the statistics counted for its file
+    public Result construct(Model model, List<List<Step>> counterexamples, Statistics statistics) {
+        Result result = new Result();
+        result.setModel(model);
+        result.setCounterexamples(counterexamples);
+        print(counterexamples, new StateIndex(model), result, statistics);
+        return result;
+    }
+
+    //Private Methods
+    private List<List<Step>> checkPart(Model model) {
+        List<String> output = null;
+        if (session != null && model.getText() == null) {
+            output = session.check(model);
+        }
+        if (output == null) {
+            //Parts of one file and files of a batch draw from the same limit of NuSMV processes
+            processes.acquireUninterruptibly();
+            try {
+                output = run(model);
+            } finally {
+                processes.release();
+            }
+        }
+        release(model);
+
+        //Each model maps its own state names and codes back to states
+        return filter.process(output, new StateIndex(model), model.getBound() != -1);
+    }
+
+    private List<String> run(Model model) {
         List<String> output = new ArrayList<>();
         try {
-            String command = "./NuSMV " + fileName.getFileName() + ".smv";
+            String command = "./NuSMV ";
+            if (model.getBound() != -1) {
+                command = command.concat("-bmc -bmc_length " + model.getBound() + " ");
+            }
+            if (model.getEncoding() != null) {
+                command = command.concat("-i " + model.getLocation() + ".ord ");
+            }
+            if (model.getText() == null) {
+                command = command.concat(model.getLocation() + ".smv");
+            }
             Process process = Runtime.getRuntime().exec(command);
+            if (model.getText() != null) {
+                //NuSMV reads the model from standard input when no file is given
+                Writer writer = new BufferedWriter(new OutputStreamWriter(process.getOutputStream()));
+                writer.write(model.getText());
+                writer.close();
+            }
             BufferedReader reader = new BufferedReader(new InputStreamReader(process.getInputStream()));
 
             String line;
@@ -41,12 +137,18 @@ public class Constructor {
         } catch (Exception e) {
             e.printStackTrace();
         }
+        return output;
+    }
 
-        print(filter.process(output, states));
+    private void release(Model model) {
+        model.setText(null);
+        if (model.isTemporary() && model.getLocation() != null) {
+            new File(model.getLocation() + ".smv").delete();
+            new File(model.getLocation() + ".ord").delete();
+        }
     }
 
-    //Private Methods
-    private void print (List<List<Step>> counterexamples) {
+    private void print (List<List<Step>> counterexamples, StateIndex index, Result result, Statistics statistics) {
         String output = "";
 
         int validCounterexampleCounter = 0;
@@ -55,8 +157,8 @@ public class Constructor {
 
         IdTransition transition = new IdTransition();
 
-        List<IdTransition> transitions = new ArrayList<>();
-        List<Integer> usedStates = new ArrayList<>();
+        PairSet transitions = new PairSet();
+        BitSet usedStates = new BitSet(index.size() + 1);
 
         for (List<Step> counterexample : counterexamples) {
             if (counterexample.size() < 3) {
@@ -87,11 +189,10 @@ public class Constructor {
                     } else {
                         transition.setFrom(transition.getTo());
                         transition.setTo(step.getState().getId());
-                        addIfNew(transition, transitions);
-                    }
-                    if (!usedStates.contains(step.getState().getId())) {
-                        usedStates.add(step.getState().getId());
+                        transitions.add(transition.getFrom(), transition.getTo());
                     }
+                    //Offset by one so the -1 id of the pseudo states still fits
+                    usedStates.set(step.getState().getId() + 1);
                 }
                 if (step.getEvent() != null) {
                     output = output.concat("EVENT = " + step.getEvent() + "\n");
@@ -104,21 +205,30 @@ public class Constructor {
         statistics.setTotalCounterexamples(validCounterexampleCounter + invalidCounterexampleCounter);
         statistics.setValidCounterexamples(validCounterexampleCounter);
         statistics.setInvalidCounterexamples(invalidCounterexampleCounter);
-        statistics.setUsedStates(usedStates.size());
+        statistics.setUsedStates(usedStates.cardinality());
         statistics.setUsedtransitions(transitions.size());
 
         output = statistics.print().concat("\n" + output);
+        result.setReport(output);
+        result.setData(statistics.getData());
+
+        Output settings = result.getModel().getOutput();
+        if (settings.persists("statistics")) {
+            try {
+                FileWriter writer = new FileWriter("statistics.txt", true);
+                writer.write(result.getData());
+                writer.close();
+            } catch (IOException e) {
+                e.printStackTrace();
+            }
+        }
 
-        try {
-            FileWriter writer = new FileWriter("statistics.txt", true);
-            writer.write(statistics.getData());
-            writer.close();
-        } catch (IOException e) {
-            e.printStackTrace();
+        if (!settings.persists("counterexample")) {
+            return;
         }
 
         try {
-            PrintWriter printWriter = new PrintWriter(fileName.getFileName() + ".counterexample");
+            PrintWriter printWriter = new PrintWriter(statistics.getFileName() + ".counterexample");
             printWriter.print(output);
             printWriter.close();
             System.out.println("OK");
@@ -126,18 +236,4 @@ public class Constructor {
             e.printStackTrace();
         }
     }
-    private void addIfNew (IdTransition transition, List<IdTransition> transitions) {
-        if (!isThere(transition, transitions)) {
-            transitions.add(transition.getClone());
-        }
-    }
-
-    private boolean isThere (IdTransition transition, List<IdTransition> transitions) {
-        for (IdTransition stored : transitions) {
-            if (stored.getFrom().equals(transition.getFrom()) && stored.getTo().equals(transition.getTo())) {
-                return true;
-            }
-        }
-        return false;
-    }
 }
@@ -8,7 +8,10 @@ import java.util.List;
 public class Filter {
 
     //Methods
-    public List<List<Step>> process(List<String> output, List<State> states) {
+    //A BMC run also ends a trace at "-- no counterexample found" and may end the output inside a
+    //trace, which is then kept as well. Its lasso traces mark the loop with "-- Loop starts here",
+    //which belongs to the trace
+    public List<List<Step>> process(List<String> output, StateIndex states, boolean bounded) {
         boolean flag = false;
         List<Step> counterexample = new ArrayList<>();
         List<List<Step>> counterexamples = new ArrayList<>();
@@ -18,29 +21,35 @@ public class Filter {
                 continue;
             }
             if (flag) {
-                if (line.length() >= 16 && line.substring(0,16).equals("-- specification")) {
+                if ((line.length() >= 16 && line.substring(0,16).equals("-- specification")) || (bounded && line.startsWith("-- no counterexample"))) {
                     flag = false;
                     List<Step> ctrxpl = new ArrayList<>(counterexample);
                     counterexamples.add(ctrxpl);
                     counterexample.clear();
                     continue;
                 }
+                if (line.startsWith("-- Loop starts here")) {
+                    continue;
+                }
                 if (line.substring(0, 4).equals("  ->")) {
                     Step step = new Step();
                     counterexample.add(step);
                 }
-                if (line.substring(0, 7).equals("    sta")) {
+                if (line.startsWith("    state = ")) {
                     State state = collectState(line, states);
                     counterexample.get(counterexample.size() -1).setState(state);
                 }
-                if (line.substring(0, 7).equals("    eve")) {
+                if (line.startsWith("    events = ")) {
                     counterexample.get(counterexample.size() -1).setEvent(collectEvent(line));
                 }
-                if (line.substring(0, 7).equals("    dec")) {
+                if (line.startsWith("    decision = ")) {
                     counterexample.get(counterexample.size() -1).setDecision(collectDecision(line));
                 }
             }
         }
+        if (bounded && flag) {
+            counterexamples.add(new ArrayList<>(counterexample));
+        }
         return counterexamples;
     }
 
@@ -53,21 +62,33 @@ public class Filter {
         return line.substring(13);
     }
 
-    private State collectState(String line, List<State> states) {
-        int index = 0;
-        for (int i = line.length() - 1; i >= 0; i--) {
-            if (line.charAt(i) != '_') {
-                index = i;
-            } else {
-                break;
+    //The id is the number after the last '_' of "    state = label_id"; an integer-encoded
+    //state prints the code itself
+    private State collectState(String line, StateIndex states) {
+        if (Character.isDigit(line.charAt(12))) {
+            State state = states.getByCode(Integer.parseInt(line.substring(12).trim()));
+            if (state == null) {
+                return new State();
             }
+            return state;
         }
-        int id = Integer.parseInt(line.substring(index));
-        for (State state : states) {
-            if (state.getId() == id) {
-                return state;
+        int id = -1;
+        for (int i = 0; i < line.length(); i++) {
+            char character = line.charAt(i);
+            if (character == '_') {
+                id = 0;
+            } else if (id >= 0) {
+                if (character < '0' || character > '9') {
+                    id = -1;
+                } else {
+                    id = id * 10 + (character - '0');
+                }
             }
         }
-        return new State();
+        State state = states.get(id);
+        if (state == null) {
+            return new State();
+        }
+        return state;
     }
 }
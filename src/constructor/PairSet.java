@@ -0,0 +1,73 @@
+package constructor;
+
+public class PairSet {
+    //Attributes
+    private long[] keys;
+    private boolean[] filled;
+    private int size;
+
+    //Constructor
+    public PairSet () {
+        keys = new long[16];
+        filled = new boolean[16];
+        size = 0;
+    }
+
+    //Methods
+    //Open addressing over the (from, to) pair packed in a long; returns false when already present
+    public boolean add (int from, int to) {
+        if ((size + 1) * 2 > keys.length) {
+            grow();
+        }
+        return insert(((long) from << 32) | (to & 0xffffffffL));
+    }
+
+    public boolean contains (int from, int to) {
+        long key = ((long) from << 32) | (to & 0xffffffffL);
+        int slot = slot(key, keys.length);
+        while (filled[slot]) {
+            if (keys[slot] == key) {
+                return true;
+            }
+            slot = (slot + 1) & (keys.length - 1);
+        }
+        return false;
+    }
+
+    public int size () {
+        return size;
+    }
+
+    //Private Methods
+    private boolean insert (long key) {
+        int slot = slot(key, keys.length);
+        while (filled[slot]) {
+            if (keys[slot] == key) {
+                return false;
+            }
+            slot = (slot + 1) & (keys.length - 1);
+        }
+        keys[slot] = key;
+        filled[slot] = true;
+        size++;
+        return true;
+    }
+
+    private void grow () {
+        long[] oldKeys = keys;
+        boolean[] oldFilled = filled;
+        keys = new long[oldKeys.length * 2];
+        filled = new boolean[oldKeys.length * 2];
+        size = 0;
+        for (int i = 0; i < oldKeys.length; i++) {
+            if (oldFilled[i]) {
+                insert(oldKeys[i]);
+            }
+        }
+    }
+
+    private int slot (long key, int length) {
+        long hash = key * 0x9E3779B97F4A7C15L;
+        return (int) (hash >>> 32) & (length - 1);
+    }
+}
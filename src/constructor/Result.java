@@ -0,0 +1,89 @@
+package constructor;
+
+import generator.model.Model;
+import global.structure.State;
+import global.structure.Transition;
+
+import java.util.List;
+
+public class Result {
+    //Attributes
+    private List<State> states;
+    private List<Transition> transitions;
+    private Model model;
+    private List<List<Step>> counterexamples;
+    private String report;
+    private String data;
+    private String error;
+
+    //Constructor
+    public Result () {
+        report = "";
+        data = "";
+    }
+
+    //Methods
+    public List<State> getStates () {
+        return states;
+    }
+
+    public void setStates (List<State> states) {
+        this.states = states;
+    }
+
+    public List<Transition> getTransitions () {
+        return transitions;
+    }
+
+    public void setTransitions (List<Transition> transitions) {
+        this.transitions = transitions;
+    }
+
+    public Model getModel () {
+        return model;
+    }
+
+    public void setModel (Model model) {
+        this.model = model;
+    }
+
+    //Every counterexample NuSMV returned, including the ones too short to count as valid
+    public List<List<Step>> getCounterexamples () {
+        return counterexamples;
+    }
+
+    public void setCounterexamples (List<List<Step>> counterexamples) {
+        this.counterexamples = counterexamples;
+    }
+
+    //Text of the .counterexample file: the statistics followed by the valid counterexamples
+    public String getReport () {
+        return report;
+    }
+
+    public void setReport (String report) {
+        this.report = report;
+    }
+
+    //Row appended to statistics.txt
+    public String getData () {
+        return data;
+    }
+
+    public void setData (String data) {
+        this.data = data;
+    }
+
+    //Syntax error the input was rejected for, null when it was analysed
+    public String getError () {
+        return error;
+    }
+
+    public void setError (String error) {
+        this.error = error;
+    }
+
+    public boolean isRejected () {
+        return error != null;
+    }
+}
@@ -0,0 +1,123 @@
+package constructor;
+
+import generator.model.Model;
+import global.tools.Configuration;
+
+import java.io.BufferedReader;
+import java.io.BufferedWriter;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.io.OutputStreamWriter;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.Executors;
+import java.util.concurrent.ScheduledExecutorService;
+import java.util.concurrent.ScheduledFuture;
+import java.util.concurrent.TimeUnit;
+
+public class Session {
+    //Attributes
+    private static final String PROMPT = "NuSMV > ";
+    private Process process;
+    private BufferedWriter input;
+    private BufferedReader output;
+    private int requests;
+    private ScheduledExecutorService watchdog;
+    private Configuration configuration;
+
+    //Constructor
+    public Session () {
+        process = null;
+        requests = 0;
+        watchdog = Executors.newSingleThreadScheduledExecutor(runnable -> {
+            Thread thread = new Thread(runnable);
+            thread.setDaemon(true);
+            return thread;
+        });
+        configuration = Configuration.getInstance();
+    }
+
+    //Methods
+    //Checks a model written to a file in one long-lived "NuSMV -int" process. The commands of a
+    //request are followed by an echo of a unique sentinel, and the output is read up to it. Returns
+    //null when the process cannot be used, so the caller can fall back to a batch run. A model that
+    //takes longer than the timeout gets no output at all, since a batch run would hang on it too
+    public synchronized List<String> check (Model model) {
+        List<String> commands = new ArrayList<>();
+        commands.add("reset");
+        if (model.getEncoding() != null) {
+            commands.add("set input_order_file " + model.getLocation() + ".ord");
+        } else {
+            commands.add("unset input_order_file");
+        }
+        commands.add("read_model -i " + model.getLocation() + ".smv");
+        if (model.getBound() != -1) {
+            commands.add("go_bmc");
+            commands.add("check_ltlspec_bmc -k " + model.getBound());
+        } else {
+            commands.add("go");
+            commands.add("check_ctlspec");
+        }
+        ScheduledFuture<?> timeout = null;
+        try {
+            if (process == null || !process.isAlive()) {
+                start();
+            }
+            //Killing the process makes the blocked read below return
+            Process running = process;
+            timeout = watchdog.schedule(running::destroyForcibly, configuration.getSessionTimeout(), TimeUnit.SECONDS);
+            String sentinel = "singularity_done_" + (++requests);
+            for (String command : commands) {
+                input.write(command + "\n");
+            }
+            input.write("echo " + sentinel + "\n");
+            input.flush();
+            List<String> lines = new ArrayList<>();
+            String line;
+            while ((line = output.readLine()) != null) {
+                while (line.startsWith(PROMPT)) {
+                    line = line.substring(PROMPT.length());
+                }
+                if (line.equals(sentinel)) {
+                    return lines;
+                }
+                lines.add(line);
+            }
+        } catch (IOException e) {
+            if (timeout == null || !timeout.isDone()) {
+                e.printStackTrace();
+            }
+        } finally {
+            if (timeout != null) {
+                timeout.cancel(false);
+            }
+        }
+        close();
+        if (timeout != null && timeout.isDone() && !timeout.isCancelled()) {
+            System.err.println("NuSMV timed out on " + model.getLocation() + ".smv");
+            return new ArrayList<>();
+        }
+        return null;
+    }
+
+    public synchronized void close () {
+        if (process == null) {
+            return;
+        }
+        try {
+            input.write("quit\n");
+            input.close();
+        } catch (IOException e) {
+            //The process is gone already
+        }
+        process.destroy();
+        process = null;
+    }
+
+    //Private Methods
+    private void start () throws IOException {
+        process = new ProcessBuilder("./NuSMV", "-int").redirectErrorStream(true).start();
+        input = new BufferedWriter(new OutputStreamWriter(process.getOutputStream()));
+        output = new BufferedReader(new InputStreamReader(process.getInputStream()));
+    }
+}
@@ -0,0 +1,60 @@
+package constructor;
+
+import generator.model.Model;
+import generator.model.StateEncoding;
+import global.structure.State;
+
+import java.util.List;
+
+public class StateIndex {
+    //Attributes
+    private State[] states;
+    private State[] codes;
+
+    //Constructor
+    //Built once per run; when two states share an id the first one in the list wins, as the old linear search did
+    public StateIndex (Model model) {
+        this(model.getStates());
+        StateEncoding encoding = model.getEncoding();
+        if (encoding != null) {
+            codes = new State[encoding.size()];
+            for (int code = 0; code < encoding.size(); code++) {
+                codes[code] = model.getState(encoding.getNode(code));
+            }
+        }
+    }
+
+    public StateIndex (List<State> states) {
+        int size = 0;
+        for (State state : states) {
+            size = Math.max(size, state.getId() + 1);
+        }
+        this.states = new State[size];
+        codes = new State[0];
+        for (State state : states) {
+            if (state.getId() >= 0 && this.states[state.getId()] == null) {
+                this.states[state.getId()] = state;
+            }
+        }
+    }
+
+    //Methods
+    public State get (int id) {
+        if (id < 0 || id >= states.length) {
+            return null;
+        }
+        return states[id];
+    }
+
+    //State written as the given value of an integer-encoded state variable
+    public State getByCode (int code) {
+        if (code < 0 || code >= codes.length) {
+            return null;
+        }
+        return codes[code];
+    }
+
+    public int size () {
+        return states.length;
+    }
+}
@@ -8,10 +8,15 @@ import extractor.state.Matrix;
 import extractor.transition.TransitionWalker;
 import global.structure.State;
 import global.structure.Transition;
+import global.tools.Output;
+import global.tools.TokenTable;
+import org.antlr.v4.runtime.Token;
 import org.antlr.v4.runtime.tree.ParseTree;
 
 import java.util.ArrayList;
+import java.util.IdentityHashMap;
 import java.util.List;
+import java.util.Map;
 
 public class Extractor {
     //Attributes
@@ -21,6 +26,7 @@ public class Extractor {
     private TransitionFilter transitionFilter;
     private List<State> states;
     private List<Transition> transitions;
+    private Map<State, String> owners;
 
     //Constructor
     public Extractor () {
@@ -30,22 +36,24 @@ public class Extractor {
         transitionFilter = new TransitionFilter();
         states = new ArrayList<>();
         transitions = new ArrayList<>();
+        owners = new IdentityHashMap<>();
     }
 
     //Public Methods
-    public void extract (ParseTree parseTree, boolean debug) {
-        states.clear();
-        transitions.clear();
+    public void extract (ParseTree parseTree, boolean debug, Output output) {
+        TokenTable.renew();
         List<Line> cppMatrix = new ArrayList<>();
         cppMatrix.add(new Line());
-
         matrix.matrixGenerator(cppMatrix, parseTree);
-        stateWalker.walk(cppMatrix, states);
-        transitionWalker.walk(states, transitions);
-        transitionFilter.filter(transitions);
+        process(cppMatrix, debug, output);
+    }
 
-        XmlPrinter xmlPrinter = new XmlPrinter();
-        xmlPrinter.print(states, transitions, debug);
+    public void extract (List<Token> tokens, boolean debug, Output output) {
+        TokenTable.renew();
+        List<Line> cppMatrix = new ArrayList<>();
+        cppMatrix.add(new Line());
+        matrix.matrixGenerator(cppMatrix, tokens);
+        process(cppMatrix, debug, output);
     }
 
     public List<State> getStates () {
@@ -56,4 +64,23 @@ public class Extractor {
         return transitions;
     }
 
+    //Class, or empty for free functions, that declares each state
+    public Map<State, String> getOwners () {
+        return owners;
+    }
+
+    //Private Methods
+    private void process (List<Line> cppMatrix, boolean debug, Output output) {
+        states.clear();
+        transitions.clear();
+
+        stateWalker.walk(cppMatrix, states);
+        owners = stateWalker.getOwners();
+        transitionWalker.walk(states, transitions, owners, stateWalker.getNamespaces());
+        transitionFilter.filter(transitions);
+
+        XmlPrinter xmlPrinter = new XmlPrinter();
+        xmlPrinter.print(states, transitions, debug, output);
+    }
+
 }
@@ -2,63 +2,55 @@ package extractor.state;
 
 import global.structure.Line;
 import global.structure.Element;
-import org.antlr.v4.runtime.tree.ParseTree;
+import global.tools.TokenTable;
 
 public class ElementExtractor {
 
     //Methods
     public Element getLevelElement(Line line) {
-        if (line.getContent().isEmpty()) {
+        if (line.isEmpty()) {
             return Element.NONE;
         }
-        for (ParseTree keyword : line.getContent()) {
-            switch (keyword.getText()) {
-                case "class" :
-                    return Element.CLASS;
-                case "struct" :
-                    return Element.STRUCT;
-                case "namespace" :
-                    return Element.NAMESPACE;
-                case "for" :
-                case "do" :
-                case "while" :
-                case "switch" :
-                    return Element.LOOP;
-                case "if" :
-                    return Element.DECISION;
-                case "else" :
-                    if (line.getContent().size() == 1) {
-                        return Element.DECISION;
-                    }
-                    break;
-                case "try" :
-                case "catch" :
-                    return Element.EXCEPTION;
-                case "~":
-                    return Element.DESTRUCTOR;
-            }
+        switch (line.getFeatures().getLevelKeyword()) {
+            case TokenTable.CLASS :
+                return Element.CLASS;
+            case TokenTable.STRUCT :
+                return Element.STRUCT;
+            case TokenTable.NAMESPACE :
+                return Element.NAMESPACE;
+            case TokenTable.FOR :
+            case TokenTable.DO :
+            case TokenTable.WHILE :
+            case TokenTable.SWITCH :
+                return Element.LOOP;
+            case TokenTable.IF :
+            case TokenTable.ELSE :
+                return Element.DECISION;
+            case TokenTable.TRY :
+            case TokenTable.CATCH :
+                return Element.EXCEPTION;
+            case TokenTable.TILDE :
+                return Element.DESTRUCTOR;
         }
         return Element.FUNCTION;
     }
 
     public Element getStateElement(Line line) {
-        for (ParseTree keyword : line.getContent()) {
-            switch (keyword.getText()) {
-                case "return" :
-                case "break" :
-                case "continue" :
-                    return Element.JUMP;
-                case "=" :
-                    return Element.ATTRIBUTION;
-                case "while" :
-                    return Element.LOOP;
-                case "case" :
-                case "default" :
-                    return Element.DECISION;
-                case "throw" :
-                    return Element.EXCEPTION;
-            }
+        switch (line.getFeatures().getStateKeyword()) {
+            case TokenTable.RETURN :
+            case TokenTable.BREAK :
+            case TokenTable.CONTINUE :
+                return Element.JUMP;
+            case TokenTable.ASSIGN :
+                return Element.ATTRIBUTION;
+            case TokenTable.WHILE :
+                return Element.LOOP;
+            case TokenTable.CASE :
+            case TokenTable.DEFAULT :
+                return Element.DECISION;
+            case TokenTable.THROW :
+                return Element.EXCEPTION;
         }
         return Element.STATEMENT;
     }
-}
\ No newline at end of file
+}
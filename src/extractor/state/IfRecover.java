@@ -1,7 +1,7 @@
 package extractor.state;
 
 import global.structure.Line;
-import org.antlr.v4.runtime.tree.ParseTree;
+import global.tools.TokenTable;
 
 import java.util.List;
 
@@ -13,9 +13,9 @@ public class IfRecover {
     //Public Methods
     public void recover(List<Line> cppMatrix, Line line) {
         Line newLine = new Line();
-        for (int i = findSplitPoint(line); i < line.getContent().size(); i++) {
-            newLine.getContent().add(line.getContent().get(i));
-            line.getContent().remove(i);
+        for (int i = findSplitPoint(line); i < line.size(); i++) {
+            newLine.append(line, i);
+            line.remove(i);
         }
         line.setEndLineCharacter("{");
         cppMatrix.add(newLine);
@@ -26,12 +26,12 @@ public class IfRecover {
         int open = 0;
         int close = 0;
         int splitPoint = 0;
-        for (ParseTree parseTree: line.getContent()) {
+        for (int i = 0; i < line.size(); i++) {
             splitPoint ++;
-            if (parseTree.getText().equals("(")) {
+            if (line.getToken(i) == TokenTable.OPEN_PARENTHESIS) {
                 open ++;
             }
-            if (parseTree.getText().equals(")")) {
+            if (line.getToken(i) == TokenTable.CLOSE_PARENTHESIS) {
                 close ++;
                 if (open == close) {
                     return splitPoint;
@@ -0,0 +1,138 @@
+package extractor.state;
+
+import global.structure.Features;
+import global.structure.Line;
+import global.tools.StringTools;
+import global.tools.TokenTable;
+
+import java.util.Arrays;
+import java.util.List;
+
+public class LineClassifier {
+    //Attributes
+    private StringTools stringTools;
+
+    //Constructor
+    public LineClassifier () {
+        stringTools = new StringTools();
+    }
+
+    //Public Methods
+    public void classify (List<Line> cppMatrix) {
+        for (Line line : cppMatrix) {
+            line.setFeatures(classify(line));
+        }
+    }
+
+    //Private Methods
+    private Features classify (Line line) {
+        Features features = new Features();
+        if (line.isEmpty()) {
+            return features;
+        }
+        features.setFirstToken(line.getToken(0));
+
+        String last = "";
+        String label = "";
+        boolean cout = false;
+        boolean coutEvent = false;
+        boolean external = false;
+        int[] callSites = new int[line.size()];
+        int calls = 0;
+        for (int i = 0; i < line.size(); i++) {
+            int token = line.getToken(i);
+            if (features.getLevelKeyword() == -1 && isLevelKeyword(token, line)) {
+                features.setLevelKeyword(token);
+            }
+            if (features.getStateKeyword() == -1 && isStateKeyword(token)) {
+                features.setStateKeyword(token);
+            }
+            if (token == TokenTable.OPEN_PARENTHESIS && features.getOpenParenthesis() == -1) {
+                features.setOpenParenthesis(i);
+            }
+            if (token == TokenTable.SCOPE) {
+                features.getQualifiers().add(last);
+            } else {
+                last = line.getText(i);
+            }
+            if (token != TokenTable.STD && token != TokenTable.COUT && token != TokenTable.ENDL) {
+                label = label.concat(line.getText(i) + " ");
+            }
+            if (token == TokenTable.COUT) {
+                cout = true;
+            } else if (cout && !coutEvent && token != TokenTable.SHIFT_LEFT) {
+                features.setCoutEvent(stringTools.noSpecialCharacters(line.getText(i)));
+                coutEvent = true;
+            }
+            //Members reached through . or -> are never calls into the file; Q::name is, and the
+            //call index resolves it against Q
+            if (!external) {
+                callSites[calls++] = i;
+            }
+            external = token == TokenTable.DOT || token == TokenTable.ARROW;
+        }
+
+        int open = features.getOpenParenthesis();
+        if (open == -1) {
+            features.setLevelLabel(line.getText(line.size() - 1));
+        } else if (open > 0) {
+            features.setLevelLabel(line.getText(open - 1));
+        }
+        features.setStateLabel(stringTools.noSpecialCharacters(label));
+        features.setReturnEvent(returnEvent(line));
+        features.setCallSites(Arrays.copyOf(callSites, calls));
+        return features;
+    }
+
+    private boolean isLevelKeyword (int token, Line line) {
+        switch (token) {
+            case TokenTable.CLASS :
+            case TokenTable.STRUCT :
+            case TokenTable.NAMESPACE :
+            case TokenTable.FOR :
+            case TokenTable.DO :
+            case TokenTable.WHILE :
+            case TokenTable.SWITCH :
+            case TokenTable.IF :
+            case TokenTable.TRY :
+            case TokenTable.CATCH :
+            case TokenTable.TILDE :
+                return true;
+            case TokenTable.ELSE :
+                return line.size() == 1;
+            default:
+                return false;
+        }
+    }
+
+    private boolean isStateKeyword (int token) {
+        switch (token) {
+            case TokenTable.RETURN :
+            case TokenTable.BREAK :
+            case TokenTable.CONTINUE :
+            case TokenTable.ASSIGN :
+            case TokenTable.WHILE :
+            case TokenTable.CASE :
+            case TokenTable.DEFAULT :
+            case TokenTable.THROW :
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    private String returnEvent (Line line) {
+        if (line.size() < 2) {
+            return "";
+        }
+        if (stringTools.noSpecialCharacters(line.getText(1)).equals("")) {
+            for (int i = 0; i < line.size(); i++) {
+                if (!stringTools.noSpecialCharacters(line.getText(i)).isEmpty()) {
+                    return stringTools.noSpecialCharacters(line.getText(i));
+                }
+            }
+            return "lambda";
+        }
+        return stringTools.noSpecialCharacters(line.getText(1));
+    }
+}
@@ -1,14 +1,21 @@
 package extractor.state;
 
 import global.structure.Line;
+import global.tools.TokenTable;
 
+import org.antlr.v4.runtime.Token;
 import org.antlr.v4.runtime.tree.ParseTree;
+import org.antlr.v4.runtime.tree.TerminalNode;
 
+import java.util.ArrayDeque;
+import java.util.Deque;
 import java.util.List;
 
 public class Matrix {
     //Attributes
     private IfRecover ifRecover;
+    private LineClassifier lineClassifier;
+    private TokenTable tokenTable;
     private boolean ifStatement;
     private boolean forLoop;
     private boolean caseCondition;
@@ -18,6 +25,7 @@ public class Matrix {
     //Constructor
     public Matrix () {
         ifRecover = new IfRecover();
+        lineClassifier = new LineClassifier();
         ifStatement = false;
         forLoop = false;
         caseCondition = false;
@@ -27,89 +35,110 @@ public class Matrix {
 
     //Public Methods
     public void matrixGenerator (List<Line> cppMatrix, ParseTree parseTree) {
-        if (parseTree instanceof org.antlr.v4.runtime.tree.TerminalNodeImpl) {
-            switch (parseTree.getText()) {
-                case "public":
-                case "private":
-                    addParseTree(cppMatrix, parseTree);
-                    setEndCharacterAndAddNewLine(cppMatrix, ":");
-                    break;
-                case "case" :
-                case "default" :
-                    caseCondition = true;
-                    addParseTree(cppMatrix, parseTree);
-                    break;
-                case "if" :
-                    ifStatement = true;
-                    addParseTree(cppMatrix, parseTree);
-                    break;
-                case "for" :
-                    forLoop = true;
-                    addParseTree(cppMatrix, parseTree);
-                    break;
-                case "(" :
-                    if (forLoop) {
-                        open++;
-                    }
-                    addParseTree(cppMatrix, parseTree);
-                    break;
-                case ")" :
-                    if (forLoop) {
-                        close++;
-                    }
-                    addParseTree(cppMatrix, parseTree);
-                    break;
-                case "{" :
-                    if (open == close) {
-                        open = 0;
-                        close = 0;
-                        forLoop = false;
-                        ifStatement = false;
-                        setEndCharacterAndAddNewLine(cppMatrix, "{");
-                    } else {
-                        addParseTree(cppMatrix, parseTree);
-                    }
-                    break;
-                case ":" :
-                    if (caseCondition) {
-                        setEndCharacterAndAddNewLine(cppMatrix, ":");
-                        caseCondition = false;
-                    }
-                    break;
-                case ";" :
-                    if (ifStatement) {
-                        ifRecover.recover(cppMatrix, cppMatrix.get(cppMatrix.size() - 1));
-                        setEndCharacterAndAddNewLine(cppMatrix, ";");
-                        setEndCharacterAndAddNewLine(cppMatrix, "}");
-                        ifStatement = false;
-                    } else if (!forLoop) {
-                        setEndCharacterAndAddNewLine(cppMatrix, ";");
-                    }
-                    break;
-                case "}" :
-                    if (!forLoop) {
-                        setEndCharacterAndAddNewLine(cppMatrix, "}");
-                    } else {
-                        addParseTree(cppMatrix, parseTree);
-                    }
-                    break;
-                default:
-                    addParseTree(cppMatrix, parseTree);
+        tokenTable = TokenTable.getInstance();
+        Deque<ParseTree> pending = new ArrayDeque<>();
+        pending.push(parseTree);
+        while (!pending.isEmpty()) {
+            ParseTree node = pending.pop();
+            if (node instanceof TerminalNode) {
+                addTerminal(cppMatrix, ((TerminalNode) node).getSymbol());
+                continue;
+            }
+            for (int i = node.getChildCount() - 1; i >= 0; i--) {
+                pending.push(node.getChild(i));
             }
         }
-        for (int i = 0; i < parseTree.getChildCount(); i++) {
-            matrixGenerator(cppMatrix, parseTree.getChild(i));
+        lineClassifier.classify(cppMatrix);
+    }
+
+    public void matrixGenerator (List<Line> cppMatrix, List<Token> tokens) {
+        tokenTable = TokenTable.getInstance();
+        for (Token token : tokens) {
+            addTerminal(cppMatrix, token);
         }
+        lineClassifier.classify(cppMatrix);
     }
 
     //Private Methods
+    private void addTerminal (List<Line> cppMatrix, Token token) {
+        int id = tokenTable.intern(token.getText());
+        switch (id) {
+            case TokenTable.PUBLIC:
+            case TokenTable.PRIVATE:
+                addToken(cppMatrix, id, token);
+                setEndCharacterAndAddNewLine(cppMatrix, ":");
+                break;
+            case TokenTable.CASE :
+            case TokenTable.DEFAULT :
+                caseCondition = true;
+                addToken(cppMatrix, id, token);
+                break;
+            case TokenTable.IF :
+                ifStatement = true;
+                addToken(cppMatrix, id, token);
+                break;
+            case TokenTable.FOR :
+                forLoop = true;
+                addToken(cppMatrix, id, token);
+                break;
+            case TokenTable.OPEN_PARENTHESIS :
+                if (forLoop) {
+                    open++;
+                }
+                addToken(cppMatrix, id, token);
+                break;
+            case TokenTable.CLOSE_PARENTHESIS :
+                if (forLoop) {
+                    close++;
+                }
+                addToken(cppMatrix, id, token);
+                break;
+            case TokenTable.OPEN_BRACE :
+                if (open == close) {
+                    open = 0;
+                    close = 0;
+                    forLoop = false;
+                    ifStatement = false;
+                    setEndCharacterAndAddNewLine(cppMatrix, "{");
+                } else {
+                    addToken(cppMatrix, id, token);
+                }
+                break;
+            case TokenTable.COLON :
+                if (caseCondition) {
+                    setEndCharacterAndAddNewLine(cppMatrix, ":");
+                    caseCondition = false;
+                }
+                break;
+            case TokenTable.SEMICOLON :
+                if (ifStatement) {
+                    ifRecover.recover(cppMatrix, cppMatrix.get(cppMatrix.size() - 1));
+                    setEndCharacterAndAddNewLine(cppMatrix, ";");
+                    setEndCharacterAndAddNewLine(cppMatrix, "}");
+                    ifStatement = false;
+                } else if (!forLoop) {
+                    setEndCharacterAndAddNewLine(cppMatrix, ";");
+                }
+                break;
+            case TokenTable.CLOSE_BRACE :
+                if (!forLoop) {
+                    setEndCharacterAndAddNewLine(cppMatrix, "}");
+                } else {
+                    addToken(cppMatrix, id, token);
+                }
+                break;
+            default:
+                addToken(cppMatrix, id, token);
+        }
+    }
+
     private void setEndCharacterAndAddNewLine (List<Line> cppMatrix, String endCharacter) {
         cppMatrix.get(cppMatrix.size() - 1).setEndLineCharacter(endCharacter);
         cppMatrix.add(new Line());
     }
 
-    private void addParseTree (List<Line> cppMatrix, ParseTree parseTree) {
-        cppMatrix.get(cppMatrix.size() - 1).getContent().add(parseTree);
+    private void addToken (List<Line> cppMatrix, int id, Token token) {
+        cppMatrix.get(cppMatrix.size() - 1).add(id, token.getLine(), token.getCharPositionInLine());
     }
 
 }
@@ -3,10 +3,16 @@ package extractor.state;
 import global.structure.*;
 import global.tools.IdGenerator;
 import global.tools.StringTools;
-import org.antlr.v4.runtime.tree.ParseTree;
+import global.tools.TokenTable;
 
+import java.util.ArrayDeque;
 import java.util.ArrayList;
+import java.util.Deque;
+import java.util.HashSet;
+import java.util.IdentityHashMap;
 import java.util.List;
+import java.util.Map;
+import java.util.Set;
 
 public class StateWalker {
     //Attributes
@@ -17,6 +23,11 @@ public class StateWalker {
     private String className;
     private StringTools stringTools;
     private List<String> namespaces;
+    private String ownerClass;
+    private String owner;
+    private Deque<Scope> ownerScopes;
+    private Map<State, String> owners;
+    private Set<String> declaredNamespaces;
 
     //Constructor
     public StateWalker () {
@@ -27,16 +38,34 @@ public class StateWalker {
         className = "";
         stringTools = new StringTools();
         namespaces = new ArrayList<>();
+        ownerClass = "";
+        owner = "";
+        ownerScopes = new ArrayDeque<>();
+        owners = new IdentityHashMap<>();
+        declaredNamespaces = new HashSet<>();
     }
 
     //Public Methods
     public void walk (List<Line> cppMatrix, List<State> states) {
+        owners = new IdentityHashMap<>();
+        declaredNamespaces = new HashSet<>();
         for (Line line : cppMatrix) {
             classify(line, states);
         }
         reset();
     }
 
+    //Class that owns each state of the last walk: the class of its enclosing function or, outside
+    //functions, the enclosing class itself
+    public Map<State, String> getOwners () {
+        return owners;
+    }
+
+    //Namespaces opened in the file of the last walk
+    public Set<String> getNamespaces () {
+        return declaredNamespaces;
+    }
+
     //Private Methods
     private void classify (Line line, List<State> states) {
         if (scopeLevel == 0) {
@@ -59,6 +88,12 @@ public class StateWalker {
                 }
                 if (newLevel.getElement() == Element.CLASS || newLevel.getElement() == Element.STRUCT) {
                     className = newLevel.getLabel();
+                    ownerScopes.push(new Scope(owner, ownerClass, scopeLevel));
+                    ownerClass = newLevel.getLabel();
+                    owner = newLevel.getLabel();
+                }
+                if (newLevel.getElement() == Element.NAMESPACE) {
+                    declaredNamespaces.add(newLevel.getLabel());
                 }
                 if (newLevel.getElement() == Element.FUNCTION) {
                     if (newLevel.getLabel().equals(className) || namespaces.contains(newLevel.getLabel())) {
@@ -83,6 +118,15 @@ public class StateWalker {
                 if (newLevel.getLabel().equals("catch")) {
                     newLevel.setId(IdGenerator.getIntegerId());
                 }
+                switch (newLevel.getElement()) {
+                    case FUNCTION:
+                    case CONSTRUCTOR:
+                    case OPERATOR:
+                    case DESTRUCTOR:
+                        ownerScopes.push(new Scope(owner, ownerClass, scopeLevel));
+                        owner = ownerOf(line);
+                }
+                owners.put(newLevel, owner);
                 states.add(newLevel);
                 scopeLevel++;
                 break;
@@ -95,10 +139,17 @@ public class StateWalker {
                 endLevel.setLine(line);
                 endLevel.setScopeLevel(scopeLevel);
                 endLevel.setVisibility(Visibility.NONE);
+                owners.put(endLevel, owner);
                 states.add(endLevel);
+                //Closing a class or function gives the states after it back to the enclosing one
+                if (!ownerScopes.isEmpty() && ownerScopes.peek().level == scopeLevel) {
+                    Scope enclosing = ownerScopes.pop();
+                    owner = enclosing.owner;
+                    ownerClass = enclosing.ownerClass;
+                }
                 break;
             case ";" :
-                if (line.getContent().isEmpty()) {
+                if (line.isEmpty()) {
                     break;
                 }
                 State statement = new State();
@@ -108,7 +159,7 @@ public class StateWalker {
                 statement.setVisibility(Visibility.NONE);
                 statement.setLine(line);
                 if (statement.getElement() == Element.JUMP) {
-                    if (firstWordInLine(statement.getLine(), "return")) {
+                    if (firstWordInLine(statement.getLine(), TokenTable.RETURN)) {
                         statement.setId(IdGenerator.getIntegerId());
                         statement.setLabel("return");
                     }
@@ -116,10 +167,11 @@ public class StateWalker {
                     statement.setId(IdGenerator.getIntegerId());
                 }
                 statement.setScopeLevel(scopeLevel);
+                owners.put(statement, owner);
                 states.add(statement);
                 break;
             case ":" :
-                if (firstWordInLine(line, "case")) {
+                if (firstWordInLine(line, TokenTable.CASE)) {
                     State caseLevel = new State();
                     caseLevel.setType(Type.STATE);
                     //caseLevel.setLabel("case_" + labelExtractor.getLevelLabel(line));
@@ -131,10 +183,11 @@ public class StateWalker {
                     if (caseLevel.getElement() != Element.JUMP) {
                         caseLevel.setId(IdGenerator.getIntegerId());
                     }
+                    owners.put(caseLevel, owner);
                     states.add(caseLevel);
                     break;
                 }
-                if (firstWordInLine(line, "default")) {
+                if (firstWordInLine(line, TokenTable.DEFAULT)) {
                     State caseLevel = new State();
                     caseLevel.setType(Type.STATE);
                     //caseLevel.setLabel("default_" + labelExtractor.getLevelLabel(line));
@@ -146,14 +199,15 @@ public class StateWalker {
                     if (caseLevel.getElement() != Element.JUMP) {
                         caseLevel.setId(IdGenerator.getIntegerId());
                     }
+                    owners.put(caseLevel, owner);
                     states.add(caseLevel);
                     break;
                 }
-                if (firstWordInLine(line, "public")) {
+                if (firstWordInLine(line, TokenTable.PUBLIC)) {
                     visibility = Visibility.PUBLIC;
                     break;
                 }
-                if (firstWordInLine(line, "private")) {
+                if (firstWordInLine(line, TokenTable.PRIVATE)) {
                     visibility = Visibility.PRIVATE;
                     break;
                 }
@@ -164,26 +218,29 @@ public class StateWalker {
     }
 
     private void colectNamespace(Line line) {
-        String last = "";
-        for (ParseTree element : line.getContent()) {
-            if (element.getText().equals("::")) {
-                if (!namespaces.contains(last) && !stringTools.allOperators().contains(last)) {
-                    namespaces.add(last);
-                }
-            } else {
-                last = element.getText();
+        for (String qualifier : line.getFeatures().getQualifiers()) {
+            if (!namespaces.contains(qualifier) && !stringTools.allOperators().contains(qualifier)) {
+                namespaces.add(qualifier);
             }
         }
     }
 
+    private String ownerOf (Line line) {
+        int open = line.getFeatures().getOpenParenthesis();
+        if (open >= 3 && line.getToken(open - 2) == TokenTable.SCOPE) {
+            return line.getText(open - 3);
+        }
+        return ownerClass;
+    }
+
     private void elseIfRecover(State state) {
-        if (firstWordInLine(state.getLine(), "else")) {
+        if (firstWordInLine(state.getLine(), TokenTable.ELSE)) {
             state.setLabel("else_if");
         }
     }
 
-    private boolean firstWordInLine (Line line, String word) {
-        return line.getContent().get(0).getText().equals(word);
+    private boolean firstWordInLine (Line line, int word) {
+        return line.getFeatures().getFirstToken() == word;
     }
 
     private void reset () {
@@ -191,5 +248,21 @@ public class StateWalker {
         visibility = Visibility.NONE;
         className = "";
         namespaces.clear();
+        ownerClass = "";
+        owner = "";
+        ownerScopes.clear();
+    }
+
+    //Owner and class in effect before a class or function level opened at the given scope level
+    private static class Scope {
+        private String owner;
+        private String ownerClass;
+        private int level;
+
+        private Scope (String owner, String ownerClass, int level) {
+            this.owner = owner;
+            this.ownerClass = ownerClass;
+            this.level = level;
+        }
     }
 }
@@ -1,79 +1,112 @@
 package extractor.tools;
 
 import global.structure.*;
+import global.tools.Configuration;
 import global.tools.FileName;
+import global.tools.Output;
 
-import java.io.PrintWriter;
+import java.io.BufferedWriter;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.OutputStream;
+import java.io.OutputStreamWriter;
+import java.io.Writer;
+import java.util.ArrayList;
 import java.util.List;
+import java.util.zip.GZIPOutputStream;
 
 public class XmlPrinter {
     //Attrbutes
     private FileName fileName;
+    private Configuration configuration;
 
     //Constructor
     public XmlPrinter() {
         fileName = FileName.getInstance();
+        configuration = Configuration.getInstance();
     }
 
     //Public Methods
-    public void print (List<State> states, List<Transition> transitions, boolean debug) {
-        String output = "";
-        for (State state : states) {
-            String line = "";
-            for (int i = 0; i < state.getScopeLevel(); i++) {
-                line = line.concat("    ");
+    //States and transitions are written one by one to the debug output and the xml file (gzipped
+    //when asked), so the document is never held in memory
+    public void print (List<State> states, List<Transition> transitions, boolean debug, Output output) {
+        List<Writer> writers = new ArrayList<>();
+        try {
+            if (debug) {
+                writers.add(new BufferedWriter(new OutputStreamWriter(System.out)));
             }
-
-            if (state.getType() == Type.STATE) {
-                line = line.concat("<state label='");
-            } else {
-                if (state.getElement() == Element.NONE) {
-                    line = line.concat("</level>");
-                    output = output.concat(line + "\n");
+            if (output.persists("xml")) {
+                writers.add(openFile());
+            }
+            if (writers.isEmpty()) {
+                return;
+            }
+            for (State state : states) {
+                for (int i = 0; i < state.getScopeLevel(); i++) {
+                    write(writers, "    ");
+                }
+                if (state.getType() != Type.STATE && state.getElement() == Element.NONE) {
+                    write(writers, "</level>\n");
                     continue;
-                } else {
-                    line = line.concat("<level label='");
                 }
+                write(writers, state.getType() == Type.STATE ? "<state label='" : "<level label='");
+                write(writers, state.getLabel());
+                write(writers, "' element='");
+                write(writers, state.getElement().toString());
+                if (state.getVisibility() != Visibility.NONE) {
+                    write(writers, "' visibility='");
+                    write(writers, state.getVisibility().toString());
+                }
+                if (state.getId() != -1) {
+                    write(writers, "' id='");
+                    write(writers, String.valueOf(state.getId()));
+                }
+                write(writers, "'>\n");
             }
-
-            line = line.concat(state.getLabel());
-            line = line.concat("' element='");
-            line = line.concat(state.getElement().toString());
-
-            if (state.getVisibility() != Visibility.NONE) {
-                line = line.concat("' visibility='");
-                line = line.concat(state.getVisibility().toString());
-            }
-
-            if (state.getId() != -1) {
-                line = line.concat("' id='");
-                line = line.concat(String.valueOf(state.getId()));
+            write(writers, "\n");
+            for (Transition transition : transitions) {
+                write(writers, "<transition from = '");
+                write(writers, transition.getFrom().getLabel() + "_" + transition.getFrom().getId());
+                write(writers, "' to = '");
+                write(writers, transition.getTo().getLabel() + "_" + transition.getTo().getId());
+                write(writers, "' event = '");
+                write(writers, transition.getEvent().getEvent());
+                write(writers, "'>\n");
             }
-
-            line = line.concat("'>");
-            output = output.concat(line + "\n");
+        } catch (IOException e) {
+            e.printStackTrace();
+        } finally {
+            close(writers, debug);
         }
-        output = output.concat("\n");
-        for (Transition transition : transitions) {
-            output = output.concat("<transition from = '");
-            output = output.concat(transition.getFrom().getLabel() + "_" + transition.getFrom().getId());
-            output = output.concat("' to = '");
-            output = output.concat(transition.getTo().getLabel() + "_" + transition.getTo().getId());
-            output = output.concat("' event = '");
-            output = output.concat(transition.getEvent().getEvent());
-            output = output.concat("'>\n");
+    }
+
+    //Private Methods
+    private Writer openFile () throws IOException {
+        if (configuration.isGzip()) {
+            OutputStream stream = new GZIPOutputStream(new FileOutputStream(fileName.getFileName() + ".xml.gz"));
+            return new BufferedWriter(new OutputStreamWriter(stream));
         }
+        return new BufferedWriter(new OutputStreamWriter(new FileOutputStream(fileName.getFileName() + ".xml")));
+    }
 
-        if (debug) {
-            System.out.print(output);
+    private void write (List<Writer> writers, String text) throws IOException {
+        for (Writer writer : writers) {
+            writer.write(text);
         }
+    }
 
-        try {
-            PrintWriter printWriter = new PrintWriter(fileName.getFileName() + ".xml");
-            printWriter.print(output);
-            printWriter.close();
-        } catch (Exception e) {
-            e.printStackTrace();
+    //The debug writer wraps System.out, which is flushed but left open
+    private void close (List<Writer> writers, boolean debug) {
+        for (int i = 0; i < writers.size(); i++) {
+            try {
+                if (debug && i == 0) {
+                    writers.get(i).flush();
+                } else {
+                    writers.get(i).close();
+                }
+            } catch (IOException e) {
+                e.printStackTrace();
+            }
         }
     }
 }
@@ -1,20 +1,15 @@
 package extractor.transition;
 
-import global.structure.Transition;
-
-import java.util.ArrayList;
-import java.util.List;
-
 public class BreakControl {
     //Attributes
     private static BreakControl uniqueInstance;
     private boolean breakFlag;
-    private List<Transition> response;
+    private Response response;
 
     //Constructor
     private BreakControl () {
         breakFlag = false;
-        response = new ArrayList<>();
+        response = Response.empty();
     }
 
     //Methods
@@ -25,11 +20,11 @@ public class BreakControl {
         return uniqueInstance;
     }
 
-    public void addResponse (List<Transition> response) {
-        this.response.addAll(response);
+    public void addResponse (Response response) {
+        this.response = this.response.append(response);
     }
 
-    public List<Transition> getResponse () {
+    public Response getResponse () {
         return response;
     }
 
@@ -43,7 +38,7 @@ public class BreakControl {
 
     public void reset () {
         breakFlag = false;
-        response.clear();
+        response = Response.empty();
     }
 
 }
@@ -0,0 +1,240 @@
+package extractor.transition;
+
+import global.structure.Element;
+import global.structure.Line;
+import global.structure.State;
+import global.tools.Statistics;
+import global.tools.TokenTable;
+
+import java.util.*;
+
+public class CallIndex {
+    //Attributes
+    private Map<String, List<State>> functions;
+    private Map<State, Signature> signatures;
+    private Map<State, String> owners;
+    private Map<State, List<State>> callees;
+    private Set<String> classes;
+    private Set<String> namespaces;
+    private Statistics statistics;
+
+    //Constructor
+    public CallIndex () {
+        functions = new HashMap<>();
+        signatures = new IdentityHashMap<>();
+        owners = new IdentityHashMap<>();
+        callees = new IdentityHashMap<>();
+        classes = new HashSet<>();
+        namespaces = new HashSet<>();
+        statistics = Statistics.getInstance();
+    }
+
+    //Public Methods
+    public void build (List<State> states, Map<State, String> owners, Set<String> namespaces) {
+        clear();
+        this.owners = owners;
+        this.namespaces.addAll(namespaces);
+        for (State state : states) {
+            if (state.getElement() == Element.FUNCTION) {
+                functions.computeIfAbsent(state.getLabel(), label -> new ArrayList<>()).add(state);
+                signatures.put(state, signature(state));
+                classes.add(signatures.get(state).getOwner());
+            }
+        }
+        classes.remove("");
+    }
+
+    //Functions called from the state's line, in call site order, resolved on first use
+    public List<State> getCallees (State state) {
+        List<State> resolved = callees.get(state);
+        if (resolved == null) {
+            resolved = resolve(state);
+            callees.put(state, resolved);
+        }
+        return resolved;
+    }
+
+    public void clear () {
+        functions.clear();
+        signatures.clear();
+        owners = new IdentityHashMap<>();
+        callees.clear();
+        classes.clear();
+        namespaces.clear();
+    }
+
+    //Private Methods
+    //A candidate is a genuine call when the name is followed by an argument list its parameters
+    //accept. A qualified call Q::name only reaches members of Q when Q is a class of the file, free
+    //functions when Q is a namespace declared in it, and nothing otherwise (std::, library types).
+    //An unqualified call drops candidates of other classes when the caller's own class has one
+    private List<State> resolve (State state) {
+        List<State> resolved = new ArrayList<>();
+        Line line = state.getLine();
+        String caller = ownerOf(state);
+        for (int callSite : line.getFeatures().getCallSites()) {
+            List<State> candidates = functions.get(line.getText(callSite));
+            if (candidates == null) {
+                continue;
+            }
+            int arguments = countArguments(line, callSite + 1);
+            String qualifier = qualifierOf(line, callSite);
+            String scope = caller;
+            boolean member = false;
+            if (qualifier != null) {
+                scope = scopeOf(qualifier);
+                member = true;
+            } else {
+                for (State candidate : candidates) {
+                    Signature signature = signatures.get(candidate);
+                    if (!caller.isEmpty() && caller.equals(signature.getOwner()) && signature.accepts(arguments)) {
+                        member = true;
+                    }
+                }
+            }
+            for (State candidate : candidates) {
+                Signature signature = signatures.get(candidate);
+                if (signature.accepts(arguments) && (!member || (scope != null && scope.equals(signature.getOwner())))) {
+                    resolved.add(candidate);
+                } else {
+                    statistics.addRejectedCall();
+                }
+            }
+        }
+        if (resolved.isEmpty()) {
+            return Collections.emptyList();
+        }
+        return resolved;
+    }
+
+    //Name before the :: that qualifies the call site, or null for an unqualified call
+    private String qualifierOf (Line line, int callSite) {
+        if (callSite >= 2 && line.getToken(callSite - 1) == TokenTable.SCOPE) {
+            return line.getText(callSite - 2);
+        }
+        return null;
+    }
+
+    //Owner that a qualifier selects, or null when it names nothing declared in the file
+    private String scopeOf (String qualifier) {
+        if (classes.contains(qualifier)) {
+            return qualifier;
+        }
+        if (namespaces.contains(qualifier)) {
+            return "";
+        }
+        return null;
+    }
+
+    private String ownerOf (State state) {
+        String owner = owners.get(state);
+        if (owner == null) {
+            return "";
+        }
+        return owner;
+    }
+
+    //Returns -1 when the name is not followed by an argument list
+    private int countArguments (Line line, int open) {
+        if (open >= line.size() || line.getToken(open) != TokenTable.OPEN_PARENTHESIS) {
+            return -1;
+        }
+        int depth = 0;
+        int commas = 0;
+        int tokens = 0;
+        for (int i = open + 1; i < line.size(); i++) {
+            int token = line.getToken(i);
+            if ((token == TokenTable.CLOSE_PARENTHESIS || token == TokenTable.CLOSE_BRACE) && depth == 0) {
+                break;
+            }
+            tokens++;
+            switch (token) {
+                case TokenTable.OPEN_PARENTHESIS :
+                case TokenTable.OPEN_BRACE :
+                    depth++;
+                    break;
+                case TokenTable.CLOSE_PARENTHESIS :
+                case TokenTable.CLOSE_BRACE :
+                    depth--;
+                    break;
+                case TokenTable.COMMA :
+                    if (depth == 0) {
+                        commas++;
+                    }
+                    break;
+            }
+        }
+        if (tokens == 0) {
+            return 0;
+        }
+        return commas + 1;
+    }
+
+    private Signature signature (State function) {
+        Signature signature = new Signature();
+        signature.setOwner(ownerOf(function));
+        Line line = function.getLine();
+        int open = line.getFeatures().getOpenParenthesis();
+        if (open == -1) {
+            signature.setMaximum(Integer.MAX_VALUE);
+            return signature;
+        }
+
+        int depth = 0;
+        int commas = 0;
+        int tokens = 0;
+        int required = -1;
+        boolean variadic = false;
+        for (int i = open + 1; i < line.size(); i++) {
+            int token = line.getToken(i);
+            if (token == TokenTable.CLOSE_PARENTHESIS && depth == 0) {
+                break;
+            }
+            tokens++;
+            switch (token) {
+                case TokenTable.OPEN_PARENTHESIS :
+                case TokenTable.OPEN_BRACE :
+                case TokenTable.LESS :
+                    depth++;
+                    break;
+                case TokenTable.CLOSE_PARENTHESIS :
+                case TokenTable.CLOSE_BRACE :
+                case TokenTable.GREATER :
+                    if (depth > 0) {
+                        depth--;
+                    }
+                    break;
+                case TokenTable.SHIFT_RIGHT :
+                    depth = Math.max(0, depth - 2);
+                    break;
+                case TokenTable.COMMA :
+                    if (depth == 0) {
+                        commas++;
+                    }
+                    break;
+                case TokenTable.ASSIGN :
+                    if (depth == 0 && required == -1) {
+                        required = commas;
+                    }
+                    break;
+                case TokenTable.ELLIPSIS :
+                    variadic = true;
+                    break;
+            }
+        }
+
+        int parameters = commas + 1;
+        if (tokens == 0 || (tokens == 1 && line.getToken(open + 1) == TokenTable.VOID)) {
+            parameters = 0;
+        }
+        if (variadic) {
+            parameters--;
+        }
+        if (required == -1 || required > parameters) {
+            required = parameters;
+        }
+        signature.setRequired(required);
+        signature.setMaximum(variadic ? Integer.MAX_VALUE : parameters);
+        return signature;
+    }
+}
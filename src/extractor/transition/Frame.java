@@ -0,0 +1,170 @@
+package extractor.transition;
+
+import global.structure.State;
+
+import java.util.List;
+
+public class Frame {
+    //Attributes
+    private State state;
+    private int scopeLevel;
+    private boolean functionLevel;
+    private boolean loopLevel;
+    private boolean stop;
+    private Phase phase;
+    private Response response;
+    private Response result;
+    private Response outsideResponse;
+    private Response childResult;
+    private List<State> callees;
+    private int callee;
+    private Response callResponse;
+    private Phase afterCall;
+    private Response falseResponse;
+    private State me;
+    private Response innerResponse;
+
+    //Constructor
+    public Frame (State state, int scopeLevel, Response response) {
+        this.state = state;
+        this.scopeLevel = scopeLevel;
+        this.response = response;
+        functionLevel = false;
+        loopLevel = false;
+        stop = false;
+        phase = Phase.HEAD;
+    }
+
+    //Methods
+    public State getState () {
+        return state;
+    }
+
+    public void setState (State state) {
+        this.state = state;
+    }
+
+    public int getScopeLevel () {
+        return scopeLevel;
+    }
+
+    public boolean isFunctionLevel () {
+        return functionLevel;
+    }
+
+    public void setFunctionLevel (boolean functionLevel) {
+        this.functionLevel = functionLevel;
+    }
+
+    public boolean isLoopLevel () {
+        return loopLevel;
+    }
+
+    public void setLoopLevel (boolean loopLevel) {
+        this.loopLevel = loopLevel;
+    }
+
+    public boolean isStop () {
+        return stop;
+    }
+
+    public void setStop (boolean stop) {
+        this.stop = stop;
+    }
+
+    public Phase getPhase () {
+        return phase;
+    }
+
+    public void setPhase (Phase phase) {
+        this.phase = phase;
+    }
+
+    public Response getResponse () {
+        return response;
+    }
+
+    public void setResponse (Response response) {
+        this.response = response;
+    }
+
+    public Response getResult () {
+        return result;
+    }
+
+    public void setResult (Response result) {
+        this.result = result;
+    }
+
+    public Response getOutsideResponse () {
+        return outsideResponse;
+    }
+
+    public void setOutsideResponse (Response outsideResponse) {
+        this.outsideResponse = outsideResponse;
+    }
+
+    public Response getChildResult () {
+        return childResult;
+    }
+
+    public void setChildResult (Response childResult) {
+        this.childResult = childResult;
+    }
+
+    public List<State> getCallees () {
+        return callees;
+    }
+
+    public void setCallees (List<State> callees) {
+        this.callees = callees;
+    }
+
+    public int getCallee () {
+        return callee;
+    }
+
+    public void setCallee (int callee) {
+        this.callee = callee;
+    }
+
+    public Response getCallResponse () {
+        return callResponse;
+    }
+
+    public void setCallResponse (Response callResponse) {
+        this.callResponse = callResponse;
+    }
+
+    public Phase getAfterCall () {
+        return afterCall;
+    }
+
+    public void setAfterCall (Phase afterCall) {
+        this.afterCall = afterCall;
+    }
+
+    public Response getFalseResponse () {
+        return falseResponse;
+    }
+
+    public void setFalseResponse (Response falseResponse) {
+        this.falseResponse = falseResponse;
+    }
+
+    public State getMe () {
+        return me;
+    }
+
+    public void setMe (State me) {
+        this.me = me;
+    }
+
+    public Response getInnerResponse () {
+        return innerResponse;
+    }
+
+    public void setInnerResponse (Response innerResponse) {
+        this.innerResponse = innerResponse;
+    }
+}
@@ -0,0 +1,81 @@
+package extractor.transition;
+
+import global.structure.*;
+import global.tools.Configuration;
+import global.tools.IdGenerator;
+import global.tools.Statistics;
+
+import java.util.ArrayList;
+import java.util.List;
+
+public class InlineBudget {
+    //Attributes
+    private static InlineBudget uniqueInstance;
+    private Configuration configuration;
+    private Statistics statistics;
+    private int depth;
+    private int inlinedStates;
+    private List<State> callStates;
+
+    //Constructor
+    private InlineBudget () {
+        configuration = Configuration.getInstance();
+        statistics = Statistics.getInstance();
+        depth = 0;
+        inlinedStates = 0;
+        callStates = new ArrayList<>();
+    }
+
+    //Methods
+    public static InlineBudget getInstance () {
+        if (uniqueInstance == null) {
+            uniqueInstance = new InlineBudget();
+        }
+        return uniqueInstance;
+    }
+
+    public boolean allows (List<Transition> transitions) {
+        return depth < configuration.getMaxInlineDepth() &&
+                inlinedStates < configuration.getMaxInlinedStates() &&
+                transitions.size() < configuration.getMaxTransitions();
+    }
+
+    public void enter () {
+        depth++;
+    }
+
+    public void exit () {
+        depth--;
+    }
+
+    public void addState () {
+        if (depth > 0) {
+            inlinedStates++;
+        }
+    }
+
+    //Opaque stand-in for a call that is not expanded; it joins the states once the walk is over
+    public State createCallState (State function) {
+        State call = new State();
+        call.setType(Type.STATE);
+        call.setElement(Element.STATEMENT);
+        call.setLabel("call_" + function.getLabel());
+        call.setVisibility(Visibility.NONE);
+        call.setScopeLevel(function.getScopeLevel());
+        call.setLine(new Line());
+        call.setId(IdGenerator.getIntegerId());
+        callStates.add(call);
+        statistics.addCutCall();
+        return call;
+    }
+
+    public List<State> getCallStates () {
+        return callStates;
+    }
+
+    public void reset () {
+        depth = 0;
+        inlinedStates = 0;
+        callStates.clear();
+    }
+}
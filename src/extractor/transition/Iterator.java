@@ -3,250 +3,321 @@ package extractor.transition;
 import global.structure.State;
 import global.structure.Transition;
 import global.tools.Statistics;
-import global.tools.StringTools;
-import org.antlr.v4.runtime.tree.ParseTree;
 
-import java.util.ArrayList;
+import java.util.ArrayDeque;
+import java.util.Deque;
 import java.util.List;
 
 public class Iterator {
     //Attributes
-    private StringTools stringTools;
     private Statistics statistics;
     private TransitionTools tools;
     private TryStorage tryStorage;
     private BreakControl breakControl;
     private ReturnControl returnControl;
-    private boolean functionLevel;
-    private boolean loopLevel;
-    private boolean stop;
-    private int scopeLevel;
-    private State state;
+    private InlineBudget inlineBudget;
+    private Deque<Frame> frames;
+    private List<State> states;
+    private List<Transition> transitions;
+    private CallIndex calls;
 
     //Constructor
-    public Iterator (State state, int scopeLevel) {
-        stringTools = new StringTools();
+    public Iterator () {
         statistics = Statistics.getInstance();
         tools = new TransitionTools();
         tryStorage = TryStorage.getInstance();
         breakControl = BreakControl.getInstance();
         returnControl = ReturnControl.getInstance();
-        functionLevel = false;
-        loopLevel = false;
-        stop = false;
-        this.scopeLevel = scopeLevel;
-        this.state = state;
+        inlineBudget = InlineBudget.getInstance();
+        frames = new ArrayDeque<>();
     }
 
     //Methods
-    public List<Transition> iterate (List<Transition> response, List<State> states, List<Transition> transitions, List<State> functions) {
-        //DEBUG
-        /*for (ParseTree element : state.getLine().getContent()) {
-            System.out.print(element.getText());
-        }
-        System.out.println();*/
-
-        List<Transition> newResponse;
-        do {
-            newResponse = (process (response, states, transitions, functions));
-            response = newResponse;
-            if (breakControl.getBreak()) {
-                if (loopLevel) {
-                    newResponse.addAll(breakControl.getResponse());
-                    breakControl.reset();
+    //Every block (function body, branch, loop body, case, try, catch, inlined call) is a frame on an
+    //explicit stack. A frame runs until it needs the response of an inner block, pushes that block and
+    //resumes at its phase once the inner frame has finished
+    public Response iterate (State state, Response response, List<State> states, List<Transition> transitions, CallIndex calls) {
+        this.states = states;
+        this.transitions = transitions;
+        this.calls = calls;
+        frames.push(new Frame(state, state.getScopeLevel(), response));
+        Response result = null;
+        while (!frames.isEmpty()) {
+            Frame inner = run(frames.peek());
+            if (inner != null) {
+                frames.push(inner);
+            } else {
+                result = frames.pop().getResult();
+                if (!frames.isEmpty()) {
+                    frames.peek().setChildResult(result);
                 }
             }
-            if (stop) {
-                break;
-            }
-        } while (state.getScopeLevel() > scopeLevel);
-        if (returnControl.getReturn()) {
-            if (functionLevel) {
-                newResponse.addAll(returnControl.getResponse());
-                returnControl.reset();
-            }
         }
-        return newResponse;
+        return result;
     }
 
-    private List<Transition> process (List<Transition> response, List<State> states, List<Transition> transitions, List<State> functions) {
-        List<Transition> outsideResponse = new ArrayList<>();
-        switch (state.getElement()) {
-            case FUNCTION:
-            case OPERATOR:
-                functionLevel = true;
-                state = tools.getNextState(state, states);
-                return response;
-            case JUMP:
-                if (state.getLabel().equals("break")) {
-                    breakControl.setBreak();
-                    breakControl.addResponse(response);
-                }
-                else if (state.getLabel().equals("return")) {
-                    tools.finalizeTransition(response, state, transitions);
-                    tools.finalizeTransition(functionCall(response, states, transitions, functions), state, transitions);
-                    tryStorage.store(tools.createTransition("exception", state, null));
-                    List<Transition> returnResponse = new ArrayList<>();
-                    returnResponse.add(tools.createTransition(extractReturnEvent(state), state, null));
-                    returnControl.setReturn();
-                    returnControl.addResponse(returnResponse);
-                }
-                stop = true;
-                state = tools.getNextState(state, states);
-                break;
-            case ATTRIBUTION:
-            case STATEMENT:
-                tools.finalizeTransition(response, state, transitions);
-                tools.finalizeTransition(functionCall(response, states, transitions, functions), state, transitions);
-                tryStorage.store(tools.createTransition("exception", state, null));
-                String event = tools.extractEvent(state.getLine());
-                outsideResponse.add(tools.createTransition(event, state, null));
-                state = tools.getNextState(state, states);
-                break;
-            case DECISION:
-                tools.finalizeTransition(response, state, transitions);
-                tools.finalizeTransition(functionCall(response, states, transitions, functions), state, transitions);
-                tryStorage.store(tools.createTransition("exception", state, null));
-                if (state.getLabel().equals("if")) {
-                    while (true) {
-                        List<Transition> falseResponse = new ArrayList<>();
-                        falseResponse.add(tools.createTransition("FALSE", state, null));
-                        outsideResponse.addAll(iterateLoop(states, transitions, functions));
-                        state = tools.getNextSameLevelState(state, states);
-                        if (!state.getLabel().equals("else_if") && !state.getLabel().equals("else")) {
-                            outsideResponse.addAll(falseResponse);
+    public void reset () {
+        frames.clear();
+        tools.clearIndex();
+    }
+
+    //Private Methods
+    private Frame run (Frame frame) {
+        while (true) {
+            State state = frame.getState();
+            switch (frame.getPhase()) {
+                case HEAD:
+                    inlineBudget.addState();
+                    frame.setOutsideResponse(Response.empty());
+                    switch (state.getElement()) {
+                        case FUNCTION:
+                        case OPERATOR:
+                            frame.setFunctionLevel(true);
+                            frame.setState(tools.getNextState(state, states));
+                            processed(frame, frame.getResponse());
+                            break;
+                        case JUMP:
+                            if (state.getLabel().equals("break")) {
+                                breakControl.setBreak();
+                                breakControl.addResponse(frame.getResponse());
+                            }
+                            else if (state.getLabel().equals("return")) {
+                                tools.finalizeTransition(frame.getResponse(), state, transitions);
+                                call(frame, Phase.RETURN_CALLED);
+                                break;
+                            }
+                            frame.setStop(true);
+                            frame.setState(tools.getNextState(state, states));
+                            processed(frame, frame.getOutsideResponse());
+                            break;
+                        case ATTRIBUTION:
+                        case STATEMENT:
+                            tools.finalizeTransition(frame.getResponse(), state, transitions);
+                            call(frame, Phase.STATEMENT_CALLED);
                             break;
-                        } else {
-                            tools.finalizeTransition(falseResponse, state, transitions);
+                        case DECISION:
+                            tools.finalizeTransition(frame.getResponse(), state, transitions);
+                            call(frame, Phase.DECISION_CALLED);
+                            break;
+                        case LOOP:
+                            frame.setLoopLevel(true);
+                            tools.finalizeTransition(frame.getResponse(), state, transitions);
+                            call(frame, Phase.LOOP_CALLED);
+                            break;
+                        case EXCEPTION:
+                            if (state.getLabel().equals("try")) {
+                                return startTry(frame);
+                            }
+                        default:
+                            frame.setState(tools.getNextState(state, states));
+                            processed(frame, frame.getResponse());
+                    }
+                    break;
+                case CALL:
+                    while (frame.getCallee() < frame.getCallees().size()) {
+                        State function = frame.getCallees().get(frame.getCallee());
+                        frame.setCallee(frame.getCallee() + 1);
+                        if (!inlineBudget.allows(transitions)) {
+                            State call = inlineBudget.createCallState(function);
+                            tools.finalizeTransition(frame.getResponse(), call, transitions);
+                            frame.setCallResponse(frame.getCallResponse().append(tools.createTransition("lambda", call, null)));
+                            continue;
                         }
+                        inlineBudget.enter();
+                        frame.setPhase(Phase.CALLED);
+                        return new Frame(function, function.getScopeLevel(), frame.getResponse());
                     }
-                } else {
-                    state = tools.getNextState(state, states);
-                    return response;
-                }
-                break;
-            case LOOP:
-                loopLevel = true;
-                tools.finalizeTransition(response, state, transitions);
-                tools.finalizeTransition(functionCall(response, states, transitions, functions), state, transitions);
-                tryStorage.store(tools.createTransition("exception", state, null));
-                if (state.getLabel().equals("do")) {
-                    tools.finalizeTransition(iterateLoop(states, transitions, functions), tools.getNextSameLevelState(state, states), transitions);
-                    transitions.add(tools.createTransition("FALSE", tools.getNextSameLevelState(state, states), state));
-                    outsideResponse.add(tools.createTransition("TRUE", tools.getNextSameLevelState(state, states), null));
-                    state = tools.getNextState(tools.getNextSameLevelState(state, states), states);
+                    tools.finalizeTransition(frame.getCallResponse(), state, transitions);
+                    frame.setPhase(frame.getAfterCall());
                     break;
-                }
-                if (state.getLabel().equals("while")) {
-                    outsideResponse.add(tools.createTransition("FALSE", state, null));
-                    //outsideResponse.addAll(iterateLoop(states, transitions, functions));
-                    tools.finalizeTransition(iterateLoop(states, transitions, functions), state, transitions);
-                    state = tools.getNextSameLevelState(state, states);
+                case CALLED:
+                    frame.setCallResponse(frame.getCallResponse().append(frame.getChildResult()));
+                    inlineBudget.exit();
+                    frame.setPhase(Phase.CALL);
                     break;
-                }
-                if (state.getLabel().equals("for")) {
-                    outsideResponse.add(tools.createTransition("FALSE", state, null));
-                    //outsideResponse.addAll(iterateLoop(states, transitions, functions));
-                    tools.finalizeTransition(iterateLoop(states, transitions, functions), state, transitions);
-                    state = tools.getNextSameLevelState(state, states);
+                case RETURN_CALLED:
+                    tryStorage.store(state);
+                    returnControl.setReturn();
+                    returnControl.addResponse(Response.of(tools.createTransition(extractReturnEvent(state), state, null)));
+                    frame.setStop(true);
+                    frame.setState(tools.getNextState(state, states));
+                    processed(frame, frame.getOutsideResponse());
                     break;
-                }
-                if (state.getLabel().equals("switch")) {
-                    State me = state;
-                    state = tools.getNextState(state, states);
-                    if (!imInside(me)) return response;
-                    List<Transition> innerResponse = new ArrayList<>();
-                    while (imInside(me)) {
-                        while (state.getLabel().equals("case")) {
-                            statistics.addStateTransition();
-                            innerResponse.add(tools.createTransition(extractReturnEvent(state), me, null));
-                            state = tools.getNextState(state, states);
-                        }
-                        if (state.getLabel().equals("default")) {
-                            //statistics.addStateTransition();
-                            innerResponse.add(tools.createTransition("lambda", me, null));
-                            state = tools.getNextState(state, states);
-                        } else {
-                            Iterator iterator = new Iterator(state, me.getScopeLevel());
-                            outsideResponse.addAll(iterator.iterate(innerResponse, states, transitions, functions));
-                            innerResponse.clear();
-                            state = tools.getNextSameLevelDecision(state, states);
+                case STATEMENT_CALLED:
+                    tryStorage.store(state);
+                    String event = tools.extractEvent(state.getLine());
+                    frame.setOutsideResponse(frame.getOutsideResponse().append(tools.createTransition(event, state, null)));
+                    frame.setState(tools.getNextState(state, states));
+                    processed(frame, frame.getOutsideResponse());
+                    break;
+                case DECISION_CALLED:
+                    tryStorage.store(state);
+                    if (state.getLabel().equals("if")) {
+                        frame.setPhase(Phase.IF_BRANCH);
+                    } else {
+                        frame.setState(tools.getNextState(state, states));
+                        processed(frame, frame.getResponse());
+                    }
+                    break;
+                case IF_BRANCH:
+                    frame.setFalseResponse(Response.of(tools.createTransition("FALSE", state, null)));
+                    frame.setPhase(Phase.IF_BRANCH_DONE);
+                    return loopBody(state);
+                case IF_BRANCH_DONE:
+                    frame.setOutsideResponse(frame.getOutsideResponse().append(frame.getChildResult()));
+                    frame.setState(tools.getNextSameLevelState(state, states));
+                    if (!frame.getState().getLabel().equals("else_if") && !frame.getState().getLabel().equals("else")) {
+                        frame.setOutsideResponse(frame.getOutsideResponse().append(frame.getFalseResponse()));
+                        processed(frame, frame.getOutsideResponse());
+                    } else {
+                        tools.finalizeTransition(frame.getFalseResponse(), frame.getState(), transitions);
+                        frame.setPhase(Phase.IF_BRANCH);
+                    }
+                    break;
+                case LOOP_CALLED:
+                    tryStorage.store(state);
+                    if (state.getLabel().equals("do")) {
+                        frame.setPhase(Phase.DO_BODY_DONE);
+                        return loopBody(state);
+                    }
+                    if (state.getLabel().equals("while") || state.getLabel().equals("for")) {
+                        frame.setOutsideResponse(frame.getOutsideResponse().append(tools.createTransition("FALSE", state, null)));
+                        frame.setPhase(Phase.WHILE_BODY_DONE);
+                        return loopBody(state);
+                    }
+                    if (state.getLabel().equals("switch")) {
+                        frame.setMe(state);
+                        frame.setState(tools.getNextState(state, states));
+                        if (!imInside(frame)) {
+                            processed(frame, frame.getResponse());
+                            break;
                         }
+                        frame.setInnerResponse(Response.empty());
+                        frame.setPhase(Phase.SWITCH_CASES);
+                        break;
+                    }
+                    if (state.getLabel().equals("try")) {
+                        return startTry(frame);
                     }
+                    frame.setState(tools.getNextState(state, states));
+                    processed(frame, frame.getResponse());
                     break;
-                }
-            case EXCEPTION:
-                if (state.getLabel().equals("try")) {
-                    tryStorage.activeTry();
-                    tools.finalizeTransition(response, state, transitions);
-                    List<Transition> tryResponse = new ArrayList<>();
-                    tryResponse.add(tools.createTransition("lambda", state, null));
-                    Iterator iterator = new Iterator(tools.getNextState(state, states), state.getScopeLevel());
-                    outsideResponse.addAll(iterator.iterate(tryResponse, states, transitions, functions));
-                    state = tools.getNextSameLevelState(state, states);
+                case DO_BODY_DONE:
+                    State end = tools.getNextSameLevelState(state, states);
+                    tools.finalizeTransition(frame.getChildResult(), end, transitions);
+                    transitions.add(tools.createTransition("FALSE", end, state));
+                    frame.setOutsideResponse(frame.getOutsideResponse().append(tools.createTransition("TRUE", end, null)));
+                    frame.setState(tools.getNextState(end, states));
+                    processed(frame, frame.getOutsideResponse());
+                    break;
+                case WHILE_BODY_DONE:
+                    tools.finalizeTransition(frame.getChildResult(), state, transitions);
+                    frame.setState(tools.getNextSameLevelState(state, states));
+                    processed(frame, frame.getOutsideResponse());
+                    break;
+                case SWITCH_CASES:
+                    if (!imInside(frame)) {
+                        processed(frame, frame.getOutsideResponse());
+                        break;
+                    }
+                    State me = frame.getMe();
+                    while (frame.getState().getLabel().equals("case")) {
+                        statistics.addStateTransition();
+                        frame.setInnerResponse(frame.getInnerResponse().append(tools.createTransition(extractReturnEvent(frame.getState()), me, null)));
+                        frame.setState(tools.getNextState(frame.getState(), states));
+                    }
+                    if (frame.getState().getLabel().equals("default")) {
+                        //statistics.addStateTransition();
+                        frame.setInnerResponse(frame.getInnerResponse().append(tools.createTransition("lambda", me, null)));
+                        frame.setState(tools.getNextState(frame.getState(), states));
+                        break;
+                    }
+                    frame.setPhase(Phase.SWITCH_CASE_DONE);
+                    return new Frame(frame.getState(), me.getScopeLevel(), frame.getInnerResponse());
+                case SWITCH_CASE_DONE:
+                    frame.setOutsideResponse(frame.getOutsideResponse().append(frame.getChildResult()));
+                    frame.setInnerResponse(Response.empty());
+                    frame.setState(tools.getNextSameLevelDecision(state, states));
+                    frame.setPhase(Phase.SWITCH_CASES);
+                    break;
+                case TRY_BODY_DONE:
+                    frame.setOutsideResponse(frame.getOutsideResponse().append(frame.getChildResult()));
+                    frame.setState(tools.getNextSameLevelState(state, states));
                     tryStorage.deactiveTry();
-                    while (state.getLabel().equals("catch")) {
+                    frame.setPhase(Phase.CATCH);
+                    break;
+                case CATCH:
+                    if (state.getLabel().equals("catch")) {
                         tools.finalizeTransition(tryStorage.getResponse(), state, transitions);
-                        List<Transition> catchResponse = new ArrayList<>();
-                        catchResponse.add(tools.createTransition("lambda", state, null));
-                        Iterator catchIterator = new Iterator(tools.getNextState(state, states), state.getScopeLevel());
-                        outsideResponse.addAll(catchIterator.iterate(catchResponse, states, transitions, functions));
-                        state = tools.getNextSameLevelState(state, states);
+                        Response catchResponse = Response.of(tools.createTransition("lambda", state, null));
+                        frame.setPhase(Phase.CATCH_BODY_DONE);
+                        return new Frame(tools.getNextState(state, states), state.getScopeLevel(), catchResponse);
                     }
                     tryStorage.reset();
+                    processed(frame, frame.getOutsideResponse());
                     break;
-                }
-            default:
-                state = tools.getNextState(state, states);
-                return response;
+                case CATCH_BODY_DONE:
+                    frame.setOutsideResponse(frame.getOutsideResponse().append(frame.getChildResult()));
+                    frame.setState(tools.getNextSameLevelState(state, states));
+                    frame.setPhase(Phase.CATCH);
+                    break;
+                case PROCESSED:
+                    if (breakControl.getBreak()) {
+                        if (frame.isLoopLevel()) {
+                            frame.setResult(frame.getResult().append(breakControl.getResponse()));
+                            breakControl.reset();
+                        }
+                    }
+                    frame.setResponse(frame.getResult());
+                    if (!frame.isStop() && frame.getState().getScopeLevel() > frame.getScopeLevel()) {
+                        frame.setPhase(Phase.HEAD);
+                        break;
+                    }
+                    if (returnControl.getReturn()) {
+                        if (frame.isFunctionLevel()) {
+                            frame.setResult(frame.getResult().append(returnControl.getResponse()));
+                            returnControl.reset();
+                        }
+                    }
+                    return null;
+            }
         }
-        return outsideResponse;
     }
 
-    private List<Transition> functionCall (List<Transition> response, List<State> states, List<Transition> transitions, List<State> functions) {
-        List<Transition> newResponse = new ArrayList<>();
-        boolean external = false;
-        for (ParseTree key : state.getLine().getContent()) {
-            for (State function : functions) {
-                if (function.getLabel().equals(key.getText()) && !external) {
-                    Iterator iterator = new Iterator(function, function.getScopeLevel());
-                    newResponse.addAll(iterator.iterate(response, states, transitions, functions));
-                }
-            }
-            if (key.getText().equals(".") || key.getText().equals("->") || key.getText().equals("::")) {
-                external = true;
-            } else {
-                external = false;
-            }
-        }
-        return newResponse;
+    private void processed (Frame frame, Response result) {
+        frame.setResult(result);
+        frame.setPhase(Phase.PROCESSED);
     }
 
-    private boolean imInside (State me) {
-        return state.getScopeLevel() == me.getScopeLevel() + 1;
+    //Inlines the functions called from the frame's state, then continues at the given phase
+    private void call (Frame frame, Phase afterCall) {
+        frame.setCallees(calls.getCallees(frame.getState()));
+        frame.setCallee(0);
+        frame.setCallResponse(Response.empty());
+        frame.setAfterCall(afterCall);
+        frame.setPhase(Phase.CALL);
     }
 
-    private String extractReturnEvent(State state) {
-        try {
-            if (stringTools.noSpecialCharacters(state.getLine().getContent().get(1).getText()).equals("")) {
-                for (ParseTree element : state.getLine().getContent()) {
-                    if (!stringTools.noSpecialCharacters(element.getText()).isEmpty()) {
-                        return stringTools.noSpecialCharacters(element.getText());
-                    }
-                }
-                return "lambda";
-            }
-            return stringTools.noSpecialCharacters(state.getLine().getContent().get(1).getText());
-        } catch (Exception e) {
-            return "";
-        }
+    private Frame startTry (Frame frame) {
+        State state = frame.getState();
+        tryStorage.activeTry();
+        tools.finalizeTransition(frame.getResponse(), state, transitions);
+        Response tryResponse = Response.of(tools.createTransition("lambda", state, null));
+        frame.setPhase(Phase.TRY_BODY_DONE);
+        return new Frame(tools.getNextState(state, states), state.getScopeLevel(), tryResponse);
+    }
+
+    private Frame loopBody (State state) {
+        Response trueResponse = Response.of(tools.createTransition("TRUE", state, null));
+        return new Frame(tools.getNextState(state, states), state.getScopeLevel(), trueResponse);
     }
 
-    private List<Transition> iterateLoop (List<State> states, List<Transition> transitions, List<State> functions) {
-        List<Transition> trueResponse = new ArrayList<>();
-        trueResponse.add(tools.createTransition("TRUE", state, null));
-        Iterator iterator = new Iterator(tools.getNextState(state, states), state.getScopeLevel());
-        return (iterator.iterate(trueResponse, states, transitions, functions));
+    private boolean imInside (Frame frame) {
+        return frame.getState().getScopeLevel() == frame.getMe().getScopeLevel() + 1;
+    }
+
+    private String extractReturnEvent(State state) {
+        return state.getLine().getFeatures().getReturnEvent();
     }
 
 }
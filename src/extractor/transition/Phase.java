@@ -0,0 +1,21 @@
+package extractor.transition;
+
+public enum Phase {
+    HEAD,
+    CALL,
+    CALLED,
+    RETURN_CALLED,
+    STATEMENT_CALLED,
+    DECISION_CALLED,
+    LOOP_CALLED,
+    IF_BRANCH,
+    IF_BRANCH_DONE,
+    DO_BODY_DONE,
+    WHILE_BODY_DONE,
+    SWITCH_CASES,
+    SWITCH_CASE_DONE,
+    TRY_BODY_DONE,
+    CATCH,
+    CATCH_BODY_DONE,
+    PROCESSED
+}
@@ -0,0 +1,90 @@
+package extractor.transition;
+
+import global.structure.Transition;
+
+import java.util.ArrayDeque;
+import java.util.Deque;
+import java.util.NoSuchElementException;
+
+public class Response implements Iterable<Transition> {
+    //Attributes
+    private static final Response EMPTY = new Response(null, null, null);
+    private Transition transition;
+    private Response left;
+    private Response right;
+    private int size;
+
+    //Constructor
+    //Immutable: appending builds a node over both sides, so handing a response to another
+    //block or controller never copies the pending transitions
+    private Response (Transition transition, Response left, Response right) {
+        this.transition = transition;
+        this.left = left;
+        this.right = right;
+        if (transition != null) {
+            size = 1;
+        } else if (left != null) {
+            size = left.size + right.size;
+        } else {
+            size = 0;
+        }
+    }
+
+    //Methods
+    public static Response empty () {
+        return EMPTY;
+    }
+
+    public static Response of (Transition transition) {
+        return new Response(transition, null, null);
+    }
+
+    public Response append (Transition transition) {
+        return append(of(transition));
+    }
+
+    public Response append (Response response) {
+        if (response.isEmpty()) {
+            return this;
+        }
+        if (isEmpty()) {
+            return response;
+        }
+        return new Response(null, this, response);
+    }
+
+    public int size () {
+        return size;
+    }
+
+    public boolean isEmpty () {
+        return size == 0;
+    }
+
+    @Override
+    public java.util.Iterator<Transition> iterator () {
+        Deque<Response> pending = new ArrayDeque<>();
+        if (!isEmpty()) {
+            pending.push(this);
+        }
+        return new java.util.Iterator<Transition>() {
+            @Override
+            public boolean hasNext () {
+                return !pending.isEmpty();
+            }
+
+            @Override
+            public Transition next () {
+                if (pending.isEmpty()) {
+                    throw new NoSuchElementException();
+                }
+                Response node = pending.pop();
+                while (node.transition == null) {
+                    pending.push(node.right);
+                    node = node.left;
+                }
+                return node.transition;
+            }
+        };
+    }
+}
@@ -1,20 +1,15 @@
 package extractor.transition;
 
-import global.structure.Transition;
-
-import java.util.ArrayList;
-import java.util.List;
-
 public class ReturnControl {
     //Attributes
     private static ReturnControl uniqueInstance;
     private boolean returnFlag;
-    private List<Transition> response;
+    private Response response;
 
     //Constructor
     private ReturnControl () {
         returnFlag = false;
-        response = new ArrayList<>();
+        response = Response.empty();
     }
 
     //Methods
@@ -25,11 +20,11 @@ public class ReturnControl {
         return uniqueInstance;
     }
 
-    public void addResponse (List<Transition> response) {
-        this.response.addAll(response);
+    public void addResponse (Response response) {
+        this.response = this.response.append(response);
     }
 
-    public List<Transition> getResponse () {
+    public Response getResponse () {
         return response;
     }
 
@@ -43,6 +38,6 @@ public class ReturnControl {
 
     public void reset () {
         returnFlag = false;
-        response.clear();
+        response = Response.empty();
     }
 }
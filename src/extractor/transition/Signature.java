@@ -0,0 +1,44 @@
+package extractor.transition;
+
+public class Signature {
+    //Attributes
+    private String owner;
+    private int required;
+    private int maximum;
+
+    //Constructor
+    public Signature () {
+        owner = "";
+        required = 0;
+        maximum = 0;
+    }
+
+    //Methods
+    public String getOwner () {
+        return owner;
+    }
+
+    public void setOwner (String owner) {
+        this.owner = owner;
+    }
+
+    public int getRequired () {
+        return required;
+    }
+
+    public void setRequired (int required) {
+        this.required = required;
+    }
+
+    public int getMaximum () {
+        return maximum;
+    }
+
+    public void setMaximum (int maximum) {
+        this.maximum = maximum;
+    }
+
+    public boolean accepts (int arguments) {
+        return arguments >= required && arguments <= maximum;
+    }
+}
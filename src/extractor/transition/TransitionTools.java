@@ -1,18 +1,22 @@
 package extractor.transition;
 
 import global.structure.*;
-import global.tools.StringTools;
-import org.antlr.v4.runtime.tree.ParseTree;
 
+import java.util.IdentityHashMap;
 import java.util.List;
+import java.util.Map;
 
 public class TransitionTools {
     //Attributes
-    private StringTools stringTools;
+    private Map<State, Integer> positions;
+    private List<State> indexed;
+    private int indexedSize;
 
     //Constructor
     public TransitionTools () {
-        stringTools = new StringTools();
+        positions = new IdentityHashMap<>();
+        indexed = null;
+        indexedSize = 0;
     }
 
     //Public Methods
@@ -42,7 +46,7 @@ public class TransitionTools {
 
     public State getNextState (State state, List<State> states) {
         try {
-            return states.get(states.indexOf(state) + 1);
+            return states.get(indexOf(state, states) + 1);
         } catch (Exception e) {
             return null;
         }
@@ -50,9 +54,10 @@ public class TransitionTools {
 
     public State getNextSameLevelState (State state, List<State> states) {
         State output = state;
+        int index = indexOf(state, states);
         try {
             do {
-                output = states.get(states.indexOf(output) + 1);
+                output = states.get(++index);
                 if (output.getScopeLevel() < state.getScopeLevel()) {
                     break;
                 }
@@ -65,9 +70,10 @@ public class TransitionTools {
 
     public State getNextSameLevelDecision (State state, List<State> states) {
         State output = state;
+        int index = indexOf(state, states);
         try {
             do {
-                output = states.get(states.indexOf(output) + 1);
+                output = states.get(++index);
                 if (output.getScopeLevel() < state.getScopeLevel()) {
                     break;
                 }
@@ -89,20 +95,10 @@ public class TransitionTools {
     }
 
     public String extractEvent(Line line) {
-        boolean flag = false;
-        for (ParseTree element : line.getContent()) {
-            if (element.getText().equals("cout")) {
-                flag = true;
-                continue;
-            }
-            if (flag && !element.getText().equals("<<")) {
-                return stringTools.noSpecialCharacters(element.getText());
-            }
-        }
-        return "lambda";
+        return line.getFeatures().getCoutEvent();
     }
 
-    public void finalizeTransition(List<Transition> response, State destiny, List<Transition> transitions) {
+    public void finalizeTransition(Iterable<Transition> response, State destiny, List<Transition> transitions) {
         for (Transition transition : response) {
             transition.setTo(destiny);
             if (!exists(transition, transitions)) {
@@ -111,7 +107,30 @@ public class TransitionTools {
         }
     }
 
+    public void clearIndex () {
+        positions.clear();
+        indexed = null;
+        indexedSize = 0;
+    }
+
     //Private Methods
+    //Position of the state in the list, rebuilt only when the list itself changes
+    private int indexOf (State state, List<State> states) {
+        if (states != indexed || states.size() != indexedSize) {
+            positions.clear();
+            for (int i = 0; i < states.size(); i++) {
+                positions.putIfAbsent(states.get(i), i);
+            }
+            indexed = states;
+            indexedSize = states.size();
+        }
+        Integer index = positions.get(state);
+        if (index == null) {
+            return -1;
+        }
+        return index;
+    }
+
     private boolean exists(Transition neo, List<Transition> transitions) {
         for (Transition saved : transitions) {
             if (neo.isEqual(saved)) {
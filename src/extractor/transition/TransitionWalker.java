@@ -5,30 +5,41 @@ import global.tools.Statistics;
 
 import java.util.ArrayList;
 import java.util.List;
+import java.util.Map;
+import java.util.Set;
 
 public class TransitionWalker {
     //Attributes
     private List<State> main;
-    private List<State> functions;
+    private CallIndex calls;
     private TransitionTools tools;
+    private Iterator iterator;
     private Transition last;
     private Statistics statistics;
+    private InlineBudget inlineBudget;
 
     //Constructor
     public TransitionWalker () {
         main = new ArrayList<>();
-        functions = new ArrayList<>();
+        calls = new CallIndex();
         tools = new TransitionTools();
+        iterator = new Iterator();
         last = tools.createInitialState();
         statistics = Statistics.getInstance();
+        inlineBudget = InlineBudget.getInstance();
     }
 
     //Public Methods
-    public void walk (List<State> states, List<Transition> transitions) {
+    public void walk (List<State> states, List<Transition> transitions, Map<State, String> owners, Set<String> namespaces) {
+        inlineBudget.reset();
+        iterator.reset();
         createMainFunction(states);
-        collectFunctions(states);
+        calls.build(states, owners, namespaces);
         loop(states, transitions);
+        states.addAll(inlineBudget.getCallStates());
         main.clear();
+        calls.clear();
+        inlineBudget.reset();
     }
 
     //Private Methods
@@ -47,20 +58,10 @@ public class TransitionWalker {
         }
     }
 
-    private void collectFunctions(List<State> states) {
-        for (State state : states) {
-            if (state.getElement() == Element.FUNCTION) {
-                functions.add(state);
-            }
-        }
-    }
-
     private void loop (List<State> states, List<Transition> transitions) {
-        List<Transition> response = new ArrayList<>();
-        response.add(tools.createTransition(last.getEvent().getEvent(), last.getFrom(), null));
+        Response response = Response.of(tools.createTransition(last.getEvent().getEvent(), last.getFrom(), null));
         for (State destiny : main) {
-            Iterator iterator = new Iterator(destiny, destiny.getScopeLevel());
-            response = iterator.iterate(response, states, transitions, functions);
+            response = iterator.iterate(destiny, response, states, transitions, calls);
         }
         tools.finalizeTransition(response, tools.createFinalState(), transitions);
     }
@@ -1,6 +1,6 @@
 package extractor.transition;
 
-import global.structure.Transition;
+import global.structure.State;
 
 import java.util.ArrayList;
 import java.util.List;
@@ -8,13 +8,13 @@ import java.util.List;
 public class TryStorage {
     //Attributes
     private static TryStorage uniqueInstance;
-    private List<Transition> response;
+    private List<State> sources;
     private boolean isTry;
     private TransitionTools tools;
 
     //Constructor
     private TryStorage () {
-        response = new ArrayList<>();
+        sources = new ArrayList<>();
         isTry = false;
         tools = new TransitionTools();
     }
@@ -27,18 +27,19 @@ public class TryStorage {
         return uniqueInstance;
     }
 
-    public void store (Transition transition) {
+    //Only the source state is kept; the exception transitions are built when a catch asks for them
+    public void store (State state) {
         if (isTry) {
-            response.add(transition);
+            sources.add(state);
         }
     }
 
-    public List<Transition> getResponse () {
-        List<Transition> clearResponse = new ArrayList<>();
-        for (Transition original : response) {
-            clearResponse.add(tools.createTransition(original.getEvent().getEvent(), original.getFrom(), null));
+    public Response getResponse () {
+        Response response = Response.empty();
+        for (State source : sources) {
+            response = response.append(tools.createTransition("exception", source, null));
         }
-        return clearResponse;
+        return response;
     }
 
     public void activeTry () {
@@ -50,7 +51,7 @@ public class TryStorage {
     }
 
     public void reset () {
-        response.clear();
+        sources.clear();
         isTry = false;
     }
 
@@ -2,14 +2,28 @@ package generator;
 
 import generator.elements.Initials;
 import generator.elements.Nexts;
+import generator.elements.Ordering;
 import generator.elements.Properties;
 import generator.elements.Variables;
+import generator.model.Composer;
+import generator.model.EventTable;
+import generator.model.Model;
+import generator.model.Slicer;
+import generator.model.StateEncoding;
 import global.structure.State;
 import global.structure.Transition;
+import global.tools.Configuration;
 import global.tools.FileName;
+import global.tools.Output;
+import global.tools.Statistics;
 
+import java.io.File;
+import java.io.IOException;
 import java.io.PrintWriter;
+import java.util.BitSet;
+import java.util.HashSet;
 import java.util.List;
+import java.util.Map;
 
 public class Generator {
     //Attributes
@@ -18,6 +32,11 @@ public class Generator {
     private Initials initials;
     private Nexts nexts;
     private Properties properties;
+    private Ordering ordering;
+    private Slicer slicer;
+    private Composer composer;
+    private Configuration configuration;
+    private Statistics statistics;
 
     //Constructor
     public Generator () {
@@ -26,68 +45,190 @@ public class Generator {
         initials = new Initials();
         nexts = new Nexts();
         properties = new Properties();
+        ordering = new Ordering();
+        slicer = new Slicer();
+        composer = new Composer();
+        configuration = Configuration.getInstance();
+        statistics = Statistics.getInstance();
     }
 
     //Public Methods
-    public List<State> generate (List<State> states, List<Transition> transitions) {
-        boolean existsBoolean = variables.existsBoolean(transitions);
+    public Model generate (List<State> states, List<Transition> transitions, Map<State, String> owners, Output output) {
+        Model model = new Model(states, transitions);
+        model.setPath(fileName.getFileName());
+        model.setOutput(output);
+        prepare(model);
+        statistics.setBound(model.getBound());
+        if (configuration.isCompositional()) {
+            for (Model component : composer.compose(model, owners)) {
+                component.setPath(fileName.getFileName() + "_component" + (model.getParts().size() + 1));
+                component.setOutput(output);
+                prepare(component);
+                model.addPart(component);
+            }
+        } else if (configuration.isSlicing()) {
+            for (Model slice : slicer.slice(model)) {
+                slice.setPath(fileName.getFileName() + "_slice" + (model.getParts().size() + 1));
+                slice.setOutput(output);
+                prepare(slice);
+                model.addPart(slice);
+            }
+        }
+        if (!model.getParts().isEmpty()) {
+            //The full model is still written for reference; its properties are checked in the parts
+            model.setPropertySources(new BitSet());
+            model.setPropertyEvents(new HashSet<>());
+        }
+        write(model);
+        for (Model part : model.getParts()) {
+            write(part);
+        }
+        return model;
+    }
+
+    //Private Methods
+    private void prepare (Model model) {
+        if (configuration.isIntegerState()) {
+            model.setEncoding(new StateEncoding(model));
+        }
+        if (isBounded(model)) {
+            model.setBound(model.getLongestPath() + 1);
+        }
+    }
+
+    private void write (Model model) {
+        EventTable events = model.getEvents();
         String output = "";
         output = output.concat(
                 "MODULE main\n" +
                 "\n" +
-                "    VAR\n" +
-                "        state : \n" +
-                "        {\n");
-        output = output.concat(variables.getStates(states, transitions));
-        output = output.concat(
-                "        };\n");
-        if (variables.existsEvent(transitions)) {
+                "    VAR\n");
+        if (model.getEncoding() != null) {
+            output = output.concat(variables.getStateRange(model));
+        } else {
+            output = output.concat(
+                    "        state : \n" +
+                    "        {\n");
+            output = output.concat(variables.getStates(model));
+            output = output.concat(
+                    "        };\n");
+        }
+        if (events.existsEvent()) {
             output = output.concat("\n" +
                     "        events :\n" +
                     "        {\n");
-            output = output.concat(variables.getEvents(transitions));
+            output = output.concat(variables.getEvents(model));
             output = output.concat("        };\n");
         }
-        if (existsBoolean) {
+        if (events.existsBoolean()) {
             output = output.concat("\n        decision : boolean;\n");
         }
+        if (model.getEncoding() != null) {
+            output = output.concat("\n    DEFINE\n");
+            output = output.concat(variables.getDefines(model));
+        }
         output = output.concat(
                 "\n" +
                 "    ASSIGN\n" +
                 "\n");
-        output = output.concat(initials.generateInitials(transitions));
+        output = output.concat(initials.generateInitials(model));
         output = output.concat("\n" +
                 "        next(state) :=\n" +
                 "            case\n");
-        output = output.concat(nexts.getNextState(transitions));
+        output = output.concat(nexts.getNextState(model));
         output = output.concat("                TRUE : state;\n" +
                 "            esac;\n");
-        if (variables.existsEvent(transitions)) {
+        if (events.existsEvent()) {
             output = output.concat("\n" +
                     "        next(events) :=\n" +
                     "            case\n");
-            output = output.concat(nexts.getNextEvents(transitions));
+            output = output.concat(nexts.getNextEvents(model));
             output = output.concat("                TRUE : events;\n" +
                     "            esac;");
         }
-        if (existsBoolean) {
+        if (events.existsBoolean()) {
             output = output.concat(
                     "\n\n" +
                     "        next(decision) :=\n" +
                     "            case\n");
-            output = output.concat(nexts.getNextBoolean(transitions));
+            output = output.concat(nexts.getNextBoolean(model));
             output = output.concat("                TRUE : {TRUE, FALSE};\n" +
                     "            esac;\n");
         }
         output = output.concat("\n");
-        output = output.concat(properties.generateProperties(states, transitions));
+        output = output.concat(properties.generateProperties(model));
+        store(model, output);
+    }
+
+    //Places the model where the I/O mode wants NuSMV to find it, and next to the source only when
+    //the smv artifact is persisted
+    private void store (Model model, String output) {
+        String order = null;
+        if (model.getEncoding() != null) {
+            order = ordering.generateOrdering(model);
+        }
+        boolean persisted = model.getOutput().persists("smv");
         try {
-            PrintWriter printWriter = new PrintWriter(fileName.getFileName() + ".smv");
-            printWriter.print(output);
-            printWriter.close();
+            if (persisted) {
+                save(model.getPath(), output, order);
+            }
+            switch (model.getOutput().getIoMode()) {
+                case PIPE:
+                    model.setText(output);
+                    if (order != null) {
+                        model.setLocation(temporaryLocation());
+                        save(model.getLocation(), null, order);
+                    }
+                    model.setTemporary(true);
+                    break;
+                case TMPFS:
+                    model.setLocation(temporaryLocation());
+                    save(model.getLocation(), output, order);
+                    model.setTemporary(true);
+                    break;
+                default:
+                    model.setLocation(model.getPath());
+                    if (!persisted) {
+                        save(model.getPath(), output, order);
+                    }
+                    model.setTemporary(!persisted);
+            }
         } catch (Exception e) {
             e.printStackTrace();
         }
-        return states;
+    }
+
+    private void save (String location, String output, String order) throws IOException {
+        if (output != null) {
+            PrintWriter printWriter = new PrintWriter(location + ".smv");
+            printWriter.print(output);
+            printWriter.close();
+        }
+        if (order != null) {
+            PrintWriter printWriter = new PrintWriter(location + ".ord");
+            printWriter.print(order);
+            printWriter.close();
+        }
+    }
+
+    private String temporaryLocation () throws IOException {
+        File directory = new File("/dev/shm");
+        if (!directory.isDirectory()) {
+            directory = new File(System.getProperty("java.io.tmpdir"));
+        }
+        File file = File.createTempFile("singularity-", ".smv", directory);
+        String location = file.getPath();
+        return location.substring(0, location.length() - ".smv".length());
+    }
+
+    private boolean isBounded (Model model) {
+        switch (configuration.getChecker()) {
+            case BMC:
+                return true;
+            case AUTO:
+                return model.getActive().cardinality() > configuration.getBmcThreshold();
+            default:
+                return false;
+        }
     }
 }
@@ -1,31 +1,27 @@
 package generator.elements;
 
-import global.structure.Transition;
+import generator.model.Model;
 
-import java.util.List;
+import java.util.BitSet;
 
 public class Initials {
-    //Attributes
-    private Variables variables;
-
-    //Constructor
-    public Initials () {
-        variables = new Variables();
-    }
-
     //Methods
-    public String generateInitials(List<Transition> transitions) {
+    public String generateInitials(Model model) {
         String output = "";
-        if (variables.existsEvent(transitions)) {
+        if (model.getEvents().existsEvent()) {
             output = "        init(events) := null;\n";
         }
         output = output.concat("        init(state) := ");
-        for (Transition transition : transitions) {
-            if (transition.getTo().getId() != -1) {
-                output = output.concat(transition.getTo().getLabel() + "_");
-                output = output.concat(transition.getTo().getId() + ";\n");
-                break;
+        BitSet initials = model.getInitials();
+        if (initials.cardinality() == 1) {
+            output = output.concat(model.getName(model.getInitial()) + ";\n");
+        } else if (initials.cardinality() > 1) {
+            //Several entry states start the run nondeterministically
+            String names = "";
+            for (int node = initials.nextSetBit(0); node >= 0; node = initials.nextSetBit(node + 1)) {
+                names = names.concat((names.isEmpty() ? "" : ", ") + model.getName(node));
             }
+            output = output.concat("{" + names + "};\n");
         }
         return output;
     }
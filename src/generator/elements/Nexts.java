@@ -1,114 +1,151 @@
 package generator.elements;
 
-import global.structure.Element;
-import global.structure.Event;
-import global.structure.Transition;
+import generator.model.EventTable;
+import generator.model.Model;
+import global.tools.Configuration;
 import global.tools.Statistics;
 
 import java.util.ArrayList;
+import java.util.BitSet;
+import java.util.LinkedHashSet;
 import java.util.List;
+import java.util.Set;
 
 public class Nexts {
     //Attributes
     private Statistics statistics;
+    private Configuration configuration;
 
     public Nexts() {
         statistics = Statistics.getInstance();
+        configuration = Configuration.getInstance();
     }
 
     //Methods
-    public String getNextState(List<Transition> transitions) {
+    public String getNextState(Model model) {
+        if (configuration.isGroupedNext()) {
+            return getGroupedNextState(model);
+        }
         String output = "";
-        for (Transition transition : transitions) {
-            if (transition.getFrom().getId() != -1 && transition.getTo().getId() != -1) {
-                String from = transition.getFrom().getLabel() + "_" + transition.getFrom().getId();
-                String to = transition.getTo().getLabel() + "_" + transition.getTo().getId();
-                String event = transition.getEvent().getEvent();
-                switch (transition.getFrom().getElement()) {
-                    case DECISION:
-                    case LOOP:
-                        if (event.equals("TRUE") || event.equals("FALSE")) {
-                            output = output.concat("                (state = " + from + " & decision = " + event + ") : " + to + ";\n");
-                            statistics.addStateTransition();
-                        }
-                        break;
-                    default:
-                        output = output.concat("                (state = " + from + ") : " + to + ";\n");
-                        statistics.addStateTransition();
+        EventTable events = model.getEvents();
+        for (int i = 0; i < model.getTransitionCount(); i++) {
+            int from = model.getSource(i);
+            int to = model.getTarget(i);
+            if (!model.isPseudo(from) && !model.isPseudo(to)) {
+                int event = model.getEventId(i);
+                if (model.isDecision(from)) {
+                    if (events.isDecision(event)) {
+                        output = output.concat("                (state = " + model.getName(from) + " & decision = " + events.getName(event) + ") : " + model.getName(to) + ";\n");
+                        count(model);
+                    }
+                } else {
+                    output = output.concat("                (state = " + model.getName(from) + ") : " + model.getName(to) + ";\n");
+                    count(model);
                 }
             }
         }
         return output;
     }
 
-    public String getNextEvents(List<Transition> transitions) {
+    public String getNextEvents(Model model) {
         String output = "";
-        List<String> lines = new ArrayList<>();
-        for (Transition transition : transitions) {
-            if (transition.getFrom().getId() != -1 && notTrivial(transition.getEvent())) {
-                switch (transition.getFrom().getElement()) {
-                    case DECISION:
-                    case LOOP:
-                        break;
-                    default:
-                        String from = transition.getFrom().getLabel() + "_" + transition.getFrom().getId();
-                        String event = transition.getEvent().getEvent();
-                        String line = ("                (state = " + from + ") : " + event + ";\n");
-                        boolean exists = false;
-                        for (String l : lines) {
-                            if (line.equals(l)) {
-                                exists = true;
-                                break;
-                            }
-                        }
-                        if (!exists) {
-                            lines.add(line);
-                        }
-                }
+        EventTable events = model.getEvents();
+        Set<String> lines = new LinkedHashSet<>();
+        for (int i = 0; i < model.getTransitionCount(); i++) {
+            int from = model.getSource(i);
+            int event = model.getEventId(i);
+            if (!model.isPseudo(from) && !events.isTrivial(event) && !model.isDecision(from)) {
+                lines.add("                (state = " + model.getName(from) + ") : " + events.getName(event) + ";\n");
             }
         }
         for (String line : lines) {
             output = output.concat(line);
-            statistics.addEventTransition();
+            if (!model.isPart()) {
+                statistics.addEventTransition();
+            }
         }
         return output;
     }
 
-    public String getNextBoolean(List<Transition> transitions) {
+    public String getNextBoolean(Model model) {
         String output = "";
-        List<String> lines = new ArrayList<>();
-        for (Transition transition : transitions) {
-            String event = transition.getEvent().getEvent();
-            if (event.equals("TRUE") || event.equals("FALSE")) {
-                switch (transition.getFrom().getElement()) {
-                    case DECISION:
-                    case LOOP:
-                        break;
-                    default:
-                        String from = transition.getFrom().getLabel() + "_" + transition.getFrom().getId();
-                        String line = ("                (state = " + from + ") : " + event + ";\n");
-                        boolean exists = false;
-                        for (String l : lines) {
-                            if (line.equals(l)) {
-                                exists = true;
-                                break;
-                            }
-                        }
-                        if (!exists) {
-                            lines.add(line);
-                        }
-                }
+        EventTable events = model.getEvents();
+        Set<String> lines = new LinkedHashSet<>();
+        for (int i = 0; i < model.getTransitionCount(); i++) {
+            int from = model.getSource(i);
+            int event = model.getEventId(i);
+            if (events.isDecision(event) && !model.isDecision(from)) {
+                lines.add("                (state = " + model.getName(from) + ") : " + events.getName(event) + ";\n");
             }
         }
         for (String line : lines) {
             output = output.concat(line);
-            statistics.addEventTransition();
+            if (!model.isPart()) {
+                statistics.addEventTransition();
+            }
         }
         return output;
     }
 
     //Private Methods
-    private boolean notTrivial(Event event) {
-        return !event.getEvent().equals("TRUE") && !event.getEvent().equals("FALSE") && !event.getEvent().equals("lambda") && !event.getEvent().equals("");
+    private void count(Model model) {
+        if (!model.isPart()) {
+            statistics.addStateTransition();
+        }
+    }
+
+    //One case line per source state (per source and decision value for DECISION and LOOP) whose
+    //right side is the set of all successors, so NuSMV keeps every branch instead of the first
+    private String getGroupedNextState(Model model) {
+        String output = "";
+        BitSet emitted = new BitSet(model.getNodeCount());
+        BitSet seen = new BitSet(model.getNodeCount());
+        for (int i = 0; i < model.getTransitionCount(); i++) {
+            int from = model.getSource(i);
+            if (model.isPseudo(from) || emitted.get(from)) {
+                continue;
+            }
+            emitted.set(from);
+            if (model.isDecision(from)) {
+                output = output.concat(getGroup(model, from, "TRUE", seen));
+                output = output.concat(getGroup(model, from, "FALSE", seen));
+            } else {
+                output = output.concat(getGroup(model, from, null, seen));
+            }
+        }
+        return output;
+    }
+
+    //Seen is shared across groups and cleared bit by bit, so a group costs its out-degree
+    private String getGroup(Model model, int from, String decision, BitSet seen) {
+        EventTable events = model.getEvents();
+        List<String> targets = new ArrayList<>();
+        for (int k = 0; k < model.getOutDegree(from); k++) {
+            int transition = model.getOut(from, k);
+            int to = model.getTarget(transition);
+            if (model.isPseudo(to) || seen.get(to)) {
+                continue;
+            }
+            if (decision != null && !events.getName(model.getEventId(transition)).equals(decision)) {
+                continue;
+            }
+            seen.set(to);
+            targets.add(model.getName(to));
+            count(model);
+        }
+        for (int k = 0; k < model.getOutDegree(from); k++) {
+            seen.clear(model.getTarget(model.getOut(from, k)));
+        }
+        if (targets.isEmpty()) {
+            return "";
+        }
+        String guard = "state = " + model.getName(from);
+        if (decision != null) {
+            guard = guard.concat(" & decision = " + decision);
+        }
+        if (targets.size() == 1) {
+            return "                (" + guard + ") : " + targets.get(0) + ";\n";
+        }
+        return "                (" + guard + ") : {" + String.join(", ", targets) + "};\n";
     }
 }
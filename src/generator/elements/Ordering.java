@@ -0,0 +1,41 @@
+package generator.elements;
+
+import generator.model.Model;
+
+public class Ordering {
+    //Methods
+    //NuSMV input order for -i: decision first, then the state bits from the most significant one,
+    //interleaved with the event bits so the variables a case line tests together stay close
+    public String generateOrdering(Model model) {
+        String output = "";
+        if (model.getEvents().existsBoolean()) {
+            output = output.concat("decision\n");
+        }
+        int stateBits = model.getEncoding().getBits();
+        int eventBits = 0;
+        if (model.getEvents().existsEvent()) {
+            eventBits = bits(model.getEvents().getEvents().size() + 1);
+        }
+        for (int i = Math.max(stateBits, eventBits) - 1; i >= 0; i--) {
+            if (i < stateBits) {
+                output = output.concat("state." + i + "\n");
+            }
+            if (i < eventBits) {
+                output = output.concat("events." + i + "\n");
+            }
+        }
+        return output;
+    }
+
+    //Private Methods
+    private int bits (int values) {
+        if (values <= 1) {
+            return 0;
+        }
+        int bits = 1;
+        while ((1 << bits) < values) {
+            bits++;
+        }
+        return bits;
+    }
+}
@@ -1,16 +1,13 @@
 package generator.elements;
 
-import global.structure.Event;
-import global.structure.State;
-import global.structure.Transition;
+import generator.model.EventTable;
+import generator.model.Model;
 import global.tools.Statistics;
 
-import java.util.ArrayList;
-import java.util.List;
-
 public class Properties {
     //Attributes
     private Statistics statistics;
+    private boolean bounded;
 
     //Constructor
     public Properties () {
@@ -18,61 +15,59 @@ public class Properties {
     }
 
     //Methods
-    public String generateProperties(List<State> states, List<Transition> transitions) {
+    //The BMC engine only checks LTL, so a bounded model gets the same properties with G and X
+    //in place of AG and EX; a violation is then a path reaching the edge, which is what we want
+    public String generateProperties(Model model) {
         String output = "";
-        output = output.concat(caseOne(transitions));
+        bounded = model.getBound() != -1;
+        output = output.concat(caseOne(model));
         output = output.concat("\n");
-        output = output.concat(caseTwo(transitions));
+        output = output.concat(caseTwo(model));
         output = output.concat("\n");
-        output = output.concat(caseThree(transitions));
+        output = output.concat(caseThree(model));
         return output;
     }
 
     //Private Methods
-    private String caseOne(List<Transition> transitions) {
+    private String caseOne(Model model) {
         String output = "";
-        List<String> events = new ArrayList<>();
-        for (Transition transition : transitions) {
-            if (notTrivial(transition.getEvent()) && !events.contains(transition.getEvent().getEvent())) {
-                events.add(transition.getEvent().getEvent());
-                output = output.concat("CTLSPEC\n   AG (events != " + transition.getEvent().getEvent() + ")\n");
-                statistics.addProperty();
-                statistics.addPropertyCaseOne();
+        EventTable events = model.getEvents();
+        for (String event : events.getEvents()) {
+            if (!model.hasEventProperty(event)) {
+                continue;
             }
+            output = output.concat(spec() + "\n   " + always() + " (events != " + event + ")\n");
+            statistics.addProperty();
+            statistics.addPropertyCaseOne();
         }
         return output;
     }
 
-    private String caseTwo(List<Transition> transitions) {
+    private String caseTwo(Model model) {
         String output = "";
-        for (Transition transition : transitions) {
-            if (transition.getFrom().getId() != -1 && transition.getTo().getId() != -1) {
-                String from = transition.getFrom().getLabel() + "_" + transition.getFrom().getId();
-                String to = transition.getTo().getLabel() + "_" + transition.getTo().getId();
-                String event = transition.getEvent().getEvent();
-                if (!event.equals("TRUE") && !event.equals("FALSE")) {
-                    continue;
-                }
-                switch (transition.getFrom().getElement()) {
-                    case DECISION:
-                    case LOOP:
-                        output = output.concat("CTLSPEC\n    AG (state = " + from + " & decision = " + event + " -> EX state != " + to + ")\n");
-                        statistics.addProperty();
-                        statistics.addPropertyCaseTwo();
-                        break;
-                }
+        EventTable events = model.getEvents();
+        for (int i = 0; i < model.getTransitionCount(); i++) {
+            int from = model.getSource(i);
+            int to = model.getTarget(i);
+            int event = model.getEventId(i);
+            if (!model.isPseudo(from) && !model.isPseudo(to) && model.hasProperties(from) && events.isDecision(event) && model.isDecision(from)) {
+                output = output.concat(spec() + "\n    " + always() + " (state = " + model.getName(from) + " & decision = " + events.getName(event) + " -> " + next() + " state != " + model.getName(to) + ")\n");
+                statistics.addProperty();
+                statistics.addPropertyCaseTwo();
             }
         }
         return output;
     }
 
-    private String caseThree(List<Transition> transitions) {
+    private String caseThree(Model model) {
         String output = "";
-        for (Transition transition : transitions) {
-            if (transition.getFrom().getId() != -1 && transition.getTo().getId() != -1) {
-                String from = transition.getFrom().getLabel() + "_" + transition.getFrom().getId();
-                String to = transition.getTo().getLabel() + "_" + transition.getTo().getId();
-                output = output.concat("CTLSPEC\n    AG (state = " + from + " -> EX state != " + to + ")\nCTLSPEC\n   AG (state != " + from + " -> EX state = " + to + ")\n");
+        for (int i = 0; i < model.getTransitionCount(); i++) {
+            int from = model.getSource(i);
+            int to = model.getTarget(i);
+            if (!model.isPseudo(from) && !model.isPseudo(to) && model.hasProperties(from)) {
+                String fromName = model.getName(from);
+                String toName = model.getName(to);
+                output = output.concat(spec() + "\n    " + always() + " (state = " + fromName + " -> " + next() + " state != " + toName + ")\n" + spec() + "\n   " + always() + " (state != " + fromName + " -> " + next() + " state = " + toName + ")\n");
                 statistics.addProperty();
                 statistics.addProperty();
                 statistics.addPropertyCaseThree();
@@ -82,7 +77,15 @@ public class Properties {
         return output;
     }
 
-    private boolean notTrivial(Event event) {
-        return !event.getEvent().equals("TRUE") && !event.getEvent().equals("FALSE") && !event.getEvent().equals("lambda") && !event.getEvent().equals("");
+    private String spec() {
+        return bounded ? "LTLSPEC" : "CTLSPEC";
+    }
+
+    private String always() {
+        return bounded ? "G" : "AG";
+    }
+
+    private String next() {
+        return bounded ? "X" : "EX";
     }
 }
@@ -1,14 +1,9 @@
 package generator.elements;
 
-import global.structure.Element;
-import global.structure.Event;
-import global.structure.State;
-import global.structure.Transition;
+import generator.model.Model;
+import generator.model.StateEncoding;
 import global.tools.Statistics;
 
-import java.util.ArrayList;
-import java.util.List;
-
 public class Variables {
     //Attributes
     private Statistics statistics;
@@ -19,15 +14,16 @@ public class Variables {
     }
 
     //Methods
-    public String getStates(List<State> states, List<Transition> transitions) {
+    public String getStates(Model model) {
         String output = "";
-        List<State> activeStates = collectActiveStates(transitions);
-        for (State state : states) {
-            if (state.getId() != -1 && activeStates.contains(state)) {
-                output = output.concat("            " + state.getLabel() + "_" + state.getId() + ",\n");
-                statistics.addState();
-                if (state.getElement().equals(Element.DECISION) || state.getElement().equals(Element.LOOP)) {
-                    statistics.addDecision();
+        for (int node = 0; node < model.getDeclaredCount(); node++) {
+            if (!model.isPseudo(node) && model.isActive(node)) {
+                output = output.concat("            " + model.getName(node) + ",\n");
+                if (!model.isPart()) {
+                    statistics.addState();
+                    if (model.isDecision(node)) {
+                        statistics.addDecision();
+                    }
                 }
             }
         }
@@ -35,63 +31,38 @@ public class Variables {
         return output;
     }
 
-    public String getEvents(List<Transition> transitions) {
-        List<String> events = new ArrayList<>();
-        String output = "            null,\n";
-        boolean valid = false;
-        for (Transition transition : transitions) {
-            if(!transition.getEvent().getEvent().equals("TRUE") &&
-                    !transition.getEvent().getEvent().equals("FALSE") &&
-                    !transition.getEvent().getEvent().equals("lambda")) {
-                if (!events.contains(transition.getEvent().getEvent()) && !transition.getEvent().getEvent().equals("")) {
-                    events.add(transition.getEvent().getEvent());
-                    valid = true;
-                    output = output.concat("            " + transition.getEvent().getEvent());
-                    statistics.addEvent();
+    public String getStateRange(Model model) {
+        StateEncoding encoding = model.getEncoding();
+        for (int code = 0; code < encoding.size(); code++) {
+            if (!model.isPart()) {
+                statistics.addState();
+                if (model.isDecision(encoding.getNode(code))) {
+                    statistics.addDecision();
                 }
             }
-            if (valid) {
-                output = output.concat(",\n");
-                valid = false;
-            }
-        }
-        output = output.substring(0, output.length() - 2) + "\n";
-        return output;
-    }
-
-    public boolean existsBoolean (List<Transition> transitions) {
-        for (Transition transition : transitions) {
-            if (transition.getEvent().getEvent().equals("TRUE") || transition.getEvent().getEvent().equals("FALSE")) {
-                return true;
-            }
         }
-        return false;
+        return "        state : 0.." + (encoding.size() - 1) + ";\n";
     }
 
-    public boolean existsEvent (List<Transition> transitions) {
-        for (Transition transition : transitions) {
-            if (!transition.getEvent().getEvent().equals("TRUE") && !transition.getEvent().getEvent().equals("FALSE") && notTrivial(transition.getEvent())) {
-                return true;
-            }
+    //Keeps the label_id names usable in the case table and the properties
+    public String getDefines(Model model) {
+        StateEncoding encoding = model.getEncoding();
+        String output = "";
+        for (int code = 0; code < encoding.size(); code++) {
+            output = output.concat("        " + model.getName(encoding.getNode(code)) + " := " + code + ";\n");
         }
-        return false;
+        return output;
     }
 
-    //Private Methods
-    private List<State> collectActiveStates(List<Transition> transitions) {
-        List<State> activeStates = new ArrayList<>();
-        for (Transition transition : transitions) {
-            if (!activeStates.contains(transition.getFrom())) {
-                activeStates.add(transition.getFrom());
-            }
-            if (!activeStates.contains(transition.getTo())) {
-                activeStates.add(transition.getTo());
+    public String getEvents(Model model) {
+        String output = "            null,\n";
+        for (String event : model.getEvents().getEvents()) {
+            output = output.concat("            " + event + ",\n");
+            if (!model.isPart()) {
+                statistics.addEvent();
             }
         }
-        return activeStates;
-    }
-
-    private boolean notTrivial(Event event) {
-        return !event.getEvent().equals("TRUE") && !event.getEvent().equals("FALSE") && !event.getEvent().equals("lambda") && !event.getEvent().equals("");
+        output = output.substring(0, output.length() - 2) + "\n";
+        return output;
     }
 }
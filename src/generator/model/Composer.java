@@ -0,0 +1,230 @@
+package generator.model;
+
+import global.structure.Element;
+import global.structure.Event;
+import global.structure.Line;
+import global.structure.State;
+import global.structure.Transition;
+import global.structure.Type;
+import global.structure.Visibility;
+
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.BitSet;
+import java.util.Deque;
+import java.util.HashSet;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+
+public class Composer {
+    //Attributes
+    private Model model;
+    private int[] components;
+    private int count;
+
+    //Methods
+    //One component per class, and one per function outside any class. Each component becomes its own
+    //flat model, checked independently of the others: its states, the states its transitions jump to
+    //in other components, and for each of those an edge back to every state of the component reachable
+    //from it through the rest of the graph
+    public List<Model> compose (Model model, Map<State, String> owners) {
+        this.model = model;
+        assign(owners);
+        List<Model> parts = new ArrayList<>();
+        for (int component = 0; component < count; component++) {
+            parts.add(build(component));
+        }
+        this.model = null;
+        return parts;
+    }
+
+    //Private Methods
+    private void assign (Map<State, String> owners) {
+        Map<String, Integer> keys = new LinkedHashMap<>();
+        count = 0;
+        components = new int[model.getNodeCount()];
+        Arrays.fill(components, -1);
+        String function = "";
+        for (int node = 0; node < model.getNodeCount(); node++) {
+            State state = model.getState(node);
+            if (model.isPseudo(node)) {
+                continue;
+            }
+            switch (state.getElement()) {
+                case FUNCTION:
+                case CONSTRUCTOR:
+                case OPERATOR:
+                case DESTRUCTOR:
+                    function = model.getName(node);
+            }
+            String owner = owners.get(state);
+            String key = owner == null || owner.isEmpty() ? function : owner;
+            Integer component = keys.get(key);
+            if (component == null) {
+                component = count++;
+                keys.put(key, component);
+            }
+            components[node] = component;
+        }
+    }
+
+    //An event property is checked in every component with an edge carrying the event, since the
+    //component where it is reachable cannot be told apart from the others here
+    private Model build (int component) {
+        BitSet members = new BitSet(model.getNodeCount());
+        for (int node = 0; node < model.getNodeCount(); node++) {
+            if (components[node] == component) {
+                members.set(node);
+            }
+        }
+        BitSet entries = entries(members);
+        List<Transition> transitions = new ArrayList<>();
+        State initial = createInitialState();
+        for (int entry = entries.nextSetBit(0); entry >= 0; entry = entries.nextSetBit(entry + 1)) {
+            transitions.add(createTransition("lambda", initial, model.getState(entry)));
+        }
+        BitSet boundary = new BitSet(model.getNodeCount());
+        Set<String> events = new HashSet<>();
+        EventTable table = model.getEvents();
+        for (int i = 0; i < model.getTransitionCount(); i++) {
+            if (!members.get(model.getSource(i))) {
+                continue;
+            }
+            transitions.add(model.getTransition(i));
+            int to = model.getTarget(i);
+            if (!members.get(to) && !model.isPseudo(to)) {
+                boundary.set(to);
+            }
+            int event = model.getEventId(i);
+            if (!table.isTrivial(event)) {
+                events.add(table.getName(event));
+            }
+        }
+        for (int node = boundary.nextSetBit(0); node >= 0; node = boundary.nextSetBit(node + 1)) {
+            BitSet reentries = reentries(node, members);
+            for (int reentry = reentries.nextSetBit(0); reentry >= 0; reentry = reentries.nextSetBit(reentry + 1)) {
+                if (model.isDecision(node)) {
+                    transitions.add(createTransition("TRUE", model.getState(node), model.getState(reentry)));
+                    transitions.add(createTransition("FALSE", model.getState(node), model.getState(reentry)));
+                } else {
+                    transitions.add(createTransition("lambda", model.getState(node), model.getState(reentry)));
+                }
+            }
+        }
+        List<State> states = new ArrayList<>();
+        for (State state : model.getStates()) {
+            int node = model.getId(state);
+            if (node != -1 && (members.get(node) || boundary.get(node))) {
+                states.add(state);
+            }
+        }
+        Model part = new Model(states, transitions);
+        part.setPart(true);
+        BitSet sources = new BitSet(part.getNodeCount());
+        for (int node = members.nextSetBit(0); node >= 0; node = members.nextSetBit(node + 1)) {
+            int partNode = part.getId(model.getState(node));
+            if (partNode != -1) {
+                sources.set(partNode);
+            }
+        }
+        part.setPropertySources(sources);
+        part.setPropertyEvents(events);
+        return part;
+    }
+
+    //Every member a run can start from: the function heads that edges from other components call and
+    //the initial states of the full model. Returns into the component are left to the reentry edges,
+    //so a run never starts halfway through a function. A component nothing enters starts at the heads
+    //no member calls, or at its first member, so its properties are still checked
+    private BitSet entries (BitSet members) {
+        BitSet entries = new BitSet(model.getNodeCount());
+        BitSet entered = new BitSet(model.getNodeCount());
+        for (int i = 0; i < model.getTransitionCount(); i++) {
+            int to = model.getTarget(i);
+            if (!members.get(to)) {
+                continue;
+            }
+            if (members.get(model.getSource(i))) {
+                entered.set(to);
+            } else if (isHead(to)) {
+                entries.set(to);
+            }
+        }
+        BitSet initials = (BitSet) model.getInitials().clone();
+        initials.and(members);
+        entries.or(initials);
+        if (entries.isEmpty()) {
+            for (int node = members.nextSetBit(0); node >= 0; node = members.nextSetBit(node + 1)) {
+                if (isHead(node) && !entered.get(node)) {
+                    entries.set(node);
+                }
+            }
+        }
+        if (entries.isEmpty()) {
+            entries.set(members.nextSetBit(0));
+        }
+        return entries;
+    }
+
+    private boolean isHead (int node) {
+        switch (model.getState(node).getElement()) {
+            case FUNCTION:
+            case CONSTRUCTOR:
+            case OPERATOR:
+            case DESTRUCTOR:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    //Members reached from a state outside the component before passing through any other member
+    private BitSet reentries (int node, BitSet members) {
+        BitSet reentries = new BitSet(model.getNodeCount());
+        BitSet visited = new BitSet(model.getNodeCount());
+        Deque<Integer> pending = new ArrayDeque<>();
+        visited.set(node);
+        pending.push(node);
+        while (!pending.isEmpty()) {
+            int current = pending.pop();
+            for (int k = 0; k < model.getOutDegree(current); k++) {
+                int to = model.getTarget(model.getOut(current, k));
+                if (visited.get(to)) {
+                    continue;
+                }
+                visited.set(to);
+                if (members.get(to)) {
+                    reentries.set(to);
+                } else if (!model.isPseudo(to)) {
+                    pending.push(to);
+                }
+            }
+        }
+        return reentries;
+    }
+
+    private State createInitialState () {
+        State initial = new State();
+        initial.setElement(Element.INITIAL);
+        initial.setLabel("initial");
+        initial.setId(-1);
+        initial.setVisibility(Visibility.NONE);
+        initial.setType(Type.NONE);
+        initial.setScopeLevel(-1);
+        initial.setLine(new Line());
+        return initial;
+    }
+
+    private Transition createTransition (String name, State from, State to) {
+        Transition transition = new Transition();
+        Event event = new Event();
+        event.setEvent(name);
+        transition.setEvent(event);
+        transition.setFrom(from);
+        transition.setTo(to);
+        return transition;
+    }
+}
@@ -0,0 +1,92 @@
+package generator.model;
+
+import global.structure.Transition;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+public class EventTable {
+    //Attributes
+    private Map<String, Integer> ids;
+    private List<String> names;
+    private List<Boolean> trivial;
+    private List<Boolean> decision;
+    private List<String> events;
+    private int[] transitionEvents;
+    private boolean existsEvent;
+    private boolean existsBoolean;
+
+    //Constructor
+    //Ids are dense and follow the order in which the events first appear in the transitions
+    public EventTable (List<Transition> transitions) {
+        ids = new HashMap<>();
+        names = new ArrayList<>();
+        trivial = new ArrayList<>();
+        decision = new ArrayList<>();
+        events = new ArrayList<>();
+        transitionEvents = new int[transitions.size()];
+        existsEvent = false;
+        existsBoolean = false;
+        for (int i = 0; i < transitions.size(); i++) {
+            transitionEvents[i] = intern(transitions.get(i).getEvent().getEvent());
+        }
+    }
+
+    //Methods
+    public int getEventId (int transition) {
+        return transitionEvents[transition];
+    }
+
+    public String getName (int id) {
+        return names.get(id);
+    }
+
+    public boolean isTrivial (int id) {
+        return trivial.get(id);
+    }
+
+    public boolean isDecision (int id) {
+        return decision.get(id);
+    }
+
+    public List<String> getEvents () {
+        return events;
+    }
+
+    public int size () {
+        return names.size();
+    }
+
+    public boolean existsEvent () {
+        return existsEvent;
+    }
+
+    public boolean existsBoolean () {
+        return existsBoolean;
+    }
+
+    //Private Methods
+    private int intern (String name) {
+        Integer id = ids.get(name);
+        if (id != null) {
+            return id;
+        }
+        id = names.size();
+        ids.put(name, id);
+        names.add(name);
+        boolean isDecision = name.equals("TRUE") || name.equals("FALSE");
+        boolean isTrivial = isDecision || name.equals("lambda") || name.equals("");
+        decision.add(isDecision);
+        trivial.add(isTrivial);
+        if (!isTrivial) {
+            events.add(name);
+            existsEvent = true;
+        }
+        if (isDecision) {
+            existsBoolean = true;
+        }
+        return id;
+    }
+}
@@ -0,0 +1,351 @@
+package generator.model;
+
+import global.structure.Element;
+import global.structure.State;
+import global.structure.Transition;
+import global.tools.Output;
+
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.BitSet;
+import java.util.Deque;
+import java.util.IdentityHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+
+public class Model {
+    //Attributes
+    private List<State> states;
+    private List<Transition> transitions;
+    private List<State> nodes;
+    private List<String> names;
+    private Map<State, Integer> ids;
+    private int declared;
+    private BitSet active;
+    private int[] sources;
+    private int[] targets;
+    private int[] outStart;
+    private int[] outTransitions;
+    private BitSet initials;
+    private EventTable events;
+    private StateEncoding encoding;
+    private int bound;
+    private String path;
+    private Output output;
+    private String location;
+    private boolean temporary;
+    private String text;
+    private boolean part;
+    private BitSet propertySources;
+    private Set<String> propertyEvents;
+    private List<Model> parts;
+
+    //Constructor
+    //Nodes are numbered densely, first in the order of the state list and then in the order the
+    //remaining states appear in the transitions, so emitting by node keeps the old state order
+    public Model (List<State> states, List<Transition> transitions) {
+        //Own copies, since the extractor reuses its lists for the next file
+        this.states = new ArrayList<>(states);
+        this.transitions = new ArrayList<>(transitions);
+        nodes = new ArrayList<>();
+        names = new ArrayList<>();
+        ids = new IdentityHashMap<>();
+        for (State state : states) {
+            node(state);
+        }
+        declared = nodes.size();
+        events = new EventTable(transitions);
+        bound = -1;
+        path = "";
+        output = null;
+        location = null;
+        temporary = false;
+        text = null;
+        part = false;
+        propertySources = null;
+        propertyEvents = null;
+        parts = new ArrayList<>();
+        sources = new int[transitions.size()];
+        targets = new int[transitions.size()];
+        initials = new BitSet();
+        int start = -1;
+        for (int i = 0; i < transitions.size(); i++) {
+            Transition transition = transitions.get(i);
+            sources[i] = node(transition.getFrom());
+            targets[i] = node(transition.getTo());
+            if (start == -1 && !isPseudo(targets[i])) {
+                start = sources[i];
+                initials.set(targets[i]);
+            }
+        }
+        //An initial pseudo state may lead to several entry states, any of which can start a run
+        if (start != -1 && nodes.get(start).getElement() == Element.INITIAL) {
+            for (int i = 0; i < transitions.size(); i++) {
+                if (sources[i] == start && !isPseudo(targets[i])) {
+                    initials.set(targets[i]);
+                }
+            }
+        }
+        active = new BitSet(nodes.size());
+        outStart = new int[nodes.size() + 1];
+        for (int i = 0; i < transitions.size(); i++) {
+            active.set(sources[i]);
+            active.set(targets[i]);
+            outStart[sources[i] + 1]++;
+        }
+        for (int node = 0; node < nodes.size(); node++) {
+            outStart[node + 1] += outStart[node];
+        }
+        int[] fill = new int[nodes.size()];
+        outTransitions = new int[transitions.size()];
+        for (int i = 0; i < transitions.size(); i++) {
+            outTransitions[outStart[sources[i]] + fill[sources[i]]++] = i;
+        }
+    }
+
+    //Methods
+    public int getNodeCount () {
+        return nodes.size();
+    }
+
+    //Nodes below this count come from the state list; the rest only appear in transitions
+    public int getDeclaredCount () {
+        return declared;
+    }
+
+    public State getState (int node) {
+        return nodes.get(node);
+    }
+
+    public String getName (int node) {
+        return names.get(node);
+    }
+
+    public int getId (State state) {
+        Integer node = ids.get(state);
+        if (node == null) {
+            return -1;
+        }
+        return node;
+    }
+
+    public boolean isPseudo (int node) {
+        return nodes.get(node).getId() == -1;
+    }
+
+    public boolean isDecision (int node) {
+        Element element = nodes.get(node).getElement();
+        return element == Element.DECISION || element == Element.LOOP;
+    }
+
+    public boolean isActive (int node) {
+        return active.get(node);
+    }
+
+    public BitSet getActive () {
+        return active;
+    }
+
+    //First initial state, -1 when the model has none
+    public int getInitial () {
+        return initials.nextSetBit(0);
+    }
+
+    public BitSet getInitials () {
+        return initials;
+    }
+
+    public int getTransitionCount () {
+        return sources.length;
+    }
+
+    public Transition getTransition (int transition) {
+        return transitions.get(transition);
+    }
+
+    public int getSource (int transition) {
+        return sources[transition];
+    }
+
+    public int getTarget (int transition) {
+        return targets[transition];
+    }
+
+    public int getEventId (int transition) {
+        return events.getEventId(transition);
+    }
+
+    //Outgoing transitions of a node, in the order they appear in the transition list
+    public int getOutDegree (int node) {
+        return outStart[node + 1] - outStart[node];
+    }
+
+    public int getOut (int node, int index) {
+        return outTransitions[outStart[node] + index];
+    }
+
+    public EventTable getEvents () {
+        return events;
+    }
+
+    public List<State> getStates () {
+        return states;
+    }
+
+    //Null unless the state variable is written as an integer range
+    public StateEncoding getEncoding () {
+        return encoding;
+    }
+
+    public void setEncoding (StateEncoding encoding) {
+        this.encoding = encoding;
+    }
+
+    //Bound for the BMC engine, -1 when the model is checked with BDDs
+    public int getBound () {
+        return bound;
+    }
+
+    public void setBound (int bound) {
+        this.bound = bound;
+    }
+
+    //File name, without extension, the model is written to and checked from
+    public String getPath () {
+        return path;
+    }
+
+    public void setPath (String path) {
+        this.path = path;
+    }
+
+    //I/O mode and persisted files of the run the model belongs to
+    public Output getOutput () {
+        return output;
+    }
+
+    public void setOutput (Output output) {
+        this.output = output;
+    }
+
+    //File name, without extension, NuSMV reads the model (and its ordering) from
+    public String getLocation () {
+        return location;
+    }
+
+    public void setLocation (String location) {
+        this.location = location;
+    }
+
+    //Files at the location are removed once the model has been checked
+    public boolean isTemporary () {
+        return temporary;
+    }
+
+    public void setTemporary (boolean temporary) {
+        this.temporary = temporary;
+    }
+
+    //Model text handed to NuSMV on its standard input, null when NuSMV reads a file
+    public String getText () {
+        return text;
+    }
+
+    public void setText (String text) {
+        this.text = text;
+    }
+
+    //A part (slice or component) only carries some of the graph, so its states and transitions
+    //are not counted again
+    public boolean isPart () {
+        return part;
+    }
+
+    public void setPart (boolean part) {
+        this.part = part;
+    }
+
+    //Which source states and events get properties; null keeps all of them
+    public boolean hasProperties (int node) {
+        return propertySources == null || propertySources.get(node);
+    }
+
+    public boolean hasEventProperty (String event) {
+        return propertyEvents == null || propertyEvents.contains(event);
+    }
+
+    public void setPropertySources (BitSet propertySources) {
+        this.propertySources = propertySources;
+    }
+
+    public void setPropertyEvents (Set<String> propertyEvents) {
+        this.propertyEvents = propertyEvents;
+    }
+
+    //Models checked in place of this one, empty when the model is checked whole
+    public List<Model> getParts () {
+        return parts;
+    }
+
+    public void addPart (Model part) {
+        parts.add(part);
+    }
+
+    //Edges on the longest path from an initial state once the back edges of a depth-first walk are
+    //dropped; every loop-free path the counterexamples need fits in it
+    public int getLongestPath () {
+        int[] post = new int[nodes.size()];
+        int[] next = new int[nodes.size()];
+        int[] order = new int[nodes.size()];
+        int count = 0;
+        BitSet visited = new BitSet(nodes.size());
+        Deque<Integer> stack = new ArrayDeque<>();
+        for (int initial = initials.nextSetBit(0); initial >= 0; initial = initials.nextSetBit(initial + 1)) {
+            if (visited.get(initial)) {
+                continue;
+            }
+            stack.push(initial);
+            visited.set(initial);
+            while (!stack.isEmpty()) {
+                int node = stack.peek();
+                if (next[node] < getOutDegree(node)) {
+                    int to = targets[getOut(node, next[node]++)];
+                    if (!visited.get(to)) {
+                        visited.set(to);
+                        stack.push(to);
+                    }
+                } else {
+                    stack.pop();
+                    post[node] = count;
+                    order[count++] = node;
+                }
+            }
+        }
+        int[] depth = new int[nodes.size()];
+        int longest = 0;
+        for (int i = count - 1; i >= 0; i--) {
+            int node = order[i];
+            longest = Math.max(longest, depth[node]);
+            for (int k = 0; k < getOutDegree(node); k++) {
+                int to = targets[getOut(node, k)];
+                if (post[to] < post[node]) {
+                    depth[to] = Math.max(depth[to], depth[node] + 1);
+                }
+            }
+        }
+        return longest;
+    }
+
+    //Private Methods
+    private int node (State state) {
+        Integer node = ids.get(state);
+        if (node == null) {
+            node = nodes.size();
+            ids.put(state, node);
+            nodes.add(state);
+            names.add(state.getLabel() + "_" + state.getId());
+        }
+        return node;
+    }
+}
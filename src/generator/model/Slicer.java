@@ -0,0 +1,238 @@
+package generator.model;
+
+import global.structure.Element;
+import global.structure.Event;
+import global.structure.Line;
+import global.structure.State;
+import global.structure.Transition;
+import global.structure.Type;
+import global.structure.Visibility;
+import global.tools.IdGenerator;
+
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.BitSet;
+import java.util.Deque;
+import java.util.HashSet;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+
+public class Slicer {
+    //Attributes
+    private Model model;
+    private int[] inStart;
+    private int[] inTransitions;
+    private BitSet reachable;
+    private State outside;
+
+    //Methods
+    //Every property of a source state only needs the states that reach it and its successors. Sources
+    //are taken from the deepest node up; each slice is the backward cone of one source plus its
+    //successors, and it takes over the properties of every source it fully contains, so each property
+    //is checked in exactly one slice. An event property needs every state with an edge carrying the
+    //event, so it goes to the first slice holding all of them, or to a slice of their joint cone.
+    //States no run from the initial states reaches hold vacuously in the full model and get no slice
+    public List<Model> slice (Model model) {
+        this.model = model;
+        outside = null;
+        buildIncoming();
+        reachable = reach();
+        List<BitSet> memberSets = new ArrayList<>();
+        List<BitSet> sourceSets = new ArrayList<>();
+        List<Set<String>> eventSets = new ArrayList<>();
+        BitSet covered = new BitSet(model.getNodeCount());
+        for (int node = model.getNodeCount() - 1; node >= 0; node--) {
+            if (!isSource(node) || covered.get(node)) {
+                continue;
+            }
+            BitSet seed = new BitSet(model.getNodeCount());
+            seed.set(node);
+            BitSet members = cone(seed);
+            BitSet sources = new BitSet(model.getNodeCount());
+            for (int member = members.nextSetBit(0); member >= 0; member = members.nextSetBit(member + 1)) {
+                if (isSource(member) && !covered.get(member) && closed(member, members)) {
+                    sources.set(member);
+                    covered.set(member);
+                }
+            }
+            memberSets.add(members);
+            sourceSets.add(sources);
+            eventSets.add(new HashSet<>());
+        }
+        for (Map.Entry<String, BitSet> entry : eventSources().entrySet()) {
+            int holder = -1;
+            for (int i = 0; i < memberSets.size() && holder == -1; i++) {
+                BitSet missing = (BitSet) entry.getValue().clone();
+                missing.andNot(memberSets.get(i));
+                if (missing.isEmpty()) {
+                    holder = i;
+                }
+            }
+            if (holder == -1) {
+                holder = memberSets.size();
+                memberSets.add(cone(entry.getValue()));
+                sourceSets.add(new BitSet(model.getNodeCount()));
+                eventSets.add(new HashSet<>());
+            }
+            eventSets.get(holder).add(entry.getKey());
+        }
+        List<Model> slices = new ArrayList<>();
+        for (int i = 0; i < memberSets.size(); i++) {
+            slices.add(build(memberSets.get(i), sourceSets.get(i), eventSets.get(i)));
+        }
+        this.model = null;
+        reachable = null;
+        return slices;
+    }
+
+    //Private Methods
+    private boolean isSource (int node) {
+        return !model.isPseudo(node) && model.getOutDegree(node) > 0 && reachable.get(node);
+    }
+
+    //States reachable from the initial states of the model. The cone of any of them holds the initial
+    //pseudo state, so its slice starts where the full model does
+    private BitSet reach () {
+        BitSet reached = (BitSet) model.getInitials().clone();
+        Deque<Integer> pending = new ArrayDeque<>();
+        for (int node = reached.nextSetBit(0); node >= 0; node = reached.nextSetBit(node + 1)) {
+            pending.push(node);
+        }
+        while (!pending.isEmpty()) {
+            int current = pending.pop();
+            for (int k = 0; k < model.getOutDegree(current); k++) {
+                int to = model.getTarget(model.getOut(current, k));
+                if (!reached.get(to)) {
+                    reached.set(to);
+                    pending.push(to);
+                }
+            }
+        }
+        return reached;
+    }
+
+    //Backward cone of the seeds plus the successors of each seed
+    private BitSet cone (BitSet seeds) {
+        BitSet members = (BitSet) seeds.clone();
+        Deque<Integer> pending = new ArrayDeque<>();
+        for (int node = seeds.nextSetBit(0); node >= 0; node = seeds.nextSetBit(node + 1)) {
+            pending.push(node);
+        }
+        while (!pending.isEmpty()) {
+            int current = pending.pop();
+            for (int k = inStart[current]; k < inStart[current + 1]; k++) {
+                int from = model.getSource(inTransitions[k]);
+                if (!members.get(from)) {
+                    members.set(from);
+                    pending.push(from);
+                }
+            }
+        }
+        for (int node = seeds.nextSetBit(0); node >= 0; node = seeds.nextSetBit(node + 1)) {
+            for (int k = 0; k < model.getOutDegree(node); k++) {
+                members.set(model.getTarget(model.getOut(node, k)));
+            }
+        }
+        return members;
+    }
+
+    private boolean closed (int node, BitSet members) {
+        for (int k = 0; k < model.getOutDegree(node); k++) {
+            if (!members.get(model.getTarget(model.getOut(node, k)))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //Reachable states with an outgoing edge carrying each non-trivial event, in event order
+    private Map<String, BitSet> eventSources () {
+        Map<String, BitSet> sources = new LinkedHashMap<>();
+        EventTable table = model.getEvents();
+        for (int i = 0; i < model.getTransitionCount(); i++) {
+            int event = model.getEventId(i);
+            int from = model.getSource(i);
+            if (!table.isTrivial(event) && !model.isPseudo(from) && reachable.get(from)) {
+                sources.computeIfAbsent(table.getName(event), name -> new BitSet(model.getNodeCount())).set(from);
+            }
+        }
+        return sources;
+    }
+
+    //Transitions leaving the slice go to a single sink state, so the first case line that matches a
+    //state is the same one as in the full model
+    private Model build (BitSet members, BitSet sources, Set<String> events) {
+        List<Transition> transitions = new ArrayList<>();
+        boolean leaves = false;
+        for (int i = 0; i < model.getTransitionCount(); i++) {
+            if (!members.get(model.getSource(i))) {
+                continue;
+            }
+            Transition original = model.getTransition(i);
+            int to = model.getTarget(i);
+            if (members.get(to) || model.isPseudo(to)) {
+                transitions.add(original);
+            } else {
+                transitions.add(leave(original));
+                leaves = true;
+            }
+        }
+        List<State> states = new ArrayList<>();
+        for (State state : model.getStates()) {
+            int node = model.getId(state);
+            if (node != -1 && members.get(node)) {
+                states.add(state);
+            }
+        }
+        if (leaves) {
+            states.add(outside);
+        }
+        Model slice = new Model(states, transitions);
+        slice.setPart(true);
+        BitSet sliceSources = new BitSet(slice.getNodeCount());
+        for (int node = sources.nextSetBit(0); node >= 0; node = sources.nextSetBit(node + 1)) {
+            sliceSources.set(slice.getId(model.getState(node)));
+        }
+        slice.setPropertySources(sliceSources);
+        slice.setPropertyEvents(events);
+        return slice;
+    }
+
+    private Transition leave (Transition original) {
+        if (outside == null) {
+            outside = new State();
+            outside.setElement(Element.STATEMENT);
+            outside.setType(Type.STATE);
+            outside.setLabel("outside");
+            outside.setVisibility(Visibility.NONE);
+            outside.setScopeLevel(-1);
+            outside.setLine(new Line());
+            outside.setId(IdGenerator.getIntegerId());
+        }
+        Transition transition = new Transition();
+        Event event = new Event();
+        event.setEvent(original.getEvent().getEvent());
+        transition.setEvent(event);
+        transition.setFrom(original.getFrom());
+        transition.setTo(outside);
+        return transition;
+    }
+
+    private void buildIncoming () {
+        inStart = new int[model.getNodeCount() + 1];
+        for (int i = 0; i < model.getTransitionCount(); i++) {
+            inStart[model.getTarget(i) + 1]++;
+        }
+        for (int node = 0; node < model.getNodeCount(); node++) {
+            inStart[node + 1] += inStart[node];
+        }
+        int[] fill = new int[model.getNodeCount()];
+        inTransitions = new int[model.getTransitionCount()];
+        for (int i = 0; i < model.getTransitionCount(); i++) {
+            int to = model.getTarget(i);
+            inTransitions[inStart[to] + fill[to]++] = i;
+        }
+    }
+}
@@ -0,0 +1,80 @@
+package generator.model;
+
+import java.util.ArrayDeque;
+import java.util.Arrays;
+import java.util.BitSet;
+import java.util.Deque;
+
+public class StateEncoding {
+    //Attributes
+    private int[] codes;
+    private int[] nodes;
+    private int size;
+
+    //Constructor
+    //Codes follow a depth-first walk of the CFG from the initial states, so states that follow each
+    //other in the code get neighbouring values; states the walk does not reach come after, in node order
+    public StateEncoding (Model model) {
+        codes = new int[model.getNodeCount()];
+        Arrays.fill(codes, -1);
+        nodes = new int[model.getNodeCount()];
+        size = 0;
+        BitSet visited = new BitSet(model.getNodeCount());
+        Deque<Integer> pending = new ArrayDeque<>();
+        BitSet initials = model.getInitials();
+        for (int initial = initials.previousSetBit(initials.length() - 1); initial >= 0; initial = initials.previousSetBit(initial - 1)) {
+            pending.push(initial);
+        }
+        while (!pending.isEmpty()) {
+            int node = pending.pop();
+            if (visited.get(node)) {
+                continue;
+            }
+            visited.set(node);
+            assign(model, node);
+            for (int k = model.getOutDegree(node) - 1; k >= 0; k--) {
+                int to = model.getTarget(model.getOut(node, k));
+                if (!visited.get(to)) {
+                    pending.push(to);
+                }
+            }
+        }
+        for (int node = 0; node < model.getDeclaredCount(); node++) {
+            assign(model, node);
+        }
+    }
+
+    //Methods
+    public int getCode (int node) {
+        return codes[node];
+    }
+
+    public int getNode (int code) {
+        return nodes[code];
+    }
+
+    public int size () {
+        return size;
+    }
+
+    //Number of boolean variables NuSMV needs for the 0..size-1 range; a single value is a constant
+    public int getBits () {
+        if (size <= 1) {
+            return 0;
+        }
+        int bits = 1;
+        while ((1 << bits) < size) {
+            bits++;
+        }
+        return bits;
+    }
+
+    //Private Methods
+    //Only the states Variables would declare get a code
+    private void assign (Model model, int node) {
+        if (codes[node] == -1 && node < model.getDeclaredCount() && !model.isPseudo(node) && model.isActive(node)) {
+            codes[node] = size;
+            nodes[size++] = node;
+        }
+    }
+}
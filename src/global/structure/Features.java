@@ -0,0 +1,109 @@
+package global.structure;
+
+import java.util.ArrayList;
+import java.util.List;
+
+public class Features {
+    //Attributes
+    private int firstToken;
+    private int levelKeyword;
+    private int stateKeyword;
+    private int openParenthesis;
+    private String levelLabel;
+    private String stateLabel;
+    private String coutEvent;
+    private String returnEvent;
+    private int[] callSites;
+    private List<String> qualifiers;
+
+    //Constructor
+    public Features () {
+        firstToken = -1;
+        levelKeyword = -1;
+        stateKeyword = -1;
+        openParenthesis = -1;
+        levelLabel = "";
+        stateLabel = "";
+        coutEvent = "lambda";
+        returnEvent = "";
+        callSites = new int[0];
+        qualifiers = new ArrayList<>();
+    }
+
+    //Methods
+    public int getFirstToken () {
+        return firstToken;
+    }
+
+    public void setFirstToken (int firstToken) {
+        this.firstToken = firstToken;
+    }
+
+    public int getLevelKeyword () {
+        return levelKeyword;
+    }
+
+    public void setLevelKeyword (int levelKeyword) {
+        this.levelKeyword = levelKeyword;
+    }
+
+    public int getStateKeyword () {
+        return stateKeyword;
+    }
+
+    public void setStateKeyword (int stateKeyword) {
+        this.stateKeyword = stateKeyword;
+    }
+
+    public int getOpenParenthesis () {
+        return openParenthesis;
+    }
+
+    public void setOpenParenthesis (int openParenthesis) {
+        this.openParenthesis = openParenthesis;
+    }
+
+    public String getLevelLabel () {
+        return levelLabel;
+    }
+
+    public void setLevelLabel (String levelLabel) {
+        this.levelLabel = levelLabel;
+    }
+
+    public String getStateLabel () {
+        return stateLabel;
+    }
+
+    public void setStateLabel (String stateLabel) {
+        this.stateLabel = stateLabel;
+    }
+
+    public String getCoutEvent () {
+        return coutEvent;
+    }
+
+    public void setCoutEvent (String coutEvent) {
+        this.coutEvent = coutEvent;
+    }
+
+    public String getReturnEvent () {
+        return returnEvent;
+    }
+
+    public void setReturnEvent (String returnEvent) {
+        this.returnEvent = returnEvent;
+    }
+
+    public int[] getCallSites () {
+        return callSites;
+    }
+
+    public void setCallSites (int[] callSites) {
+        this.callSites = callSites;
+    }
+
+    public List<String> getQualifiers () {
+        return qualifiers;
+    }
+}
@@ -1,24 +1,84 @@
 package global.structure;
 
-import org.antlr.v4.runtime.tree.ParseTree;
+import global.tools.TokenTable;
 
-import java.util.ArrayList;
-import java.util.List;
+import java.util.Arrays;
 
 public class Line {
     //Attributes
-    private List<ParseTree> content;
+    private TokenTable tokenTable;
+    private int[] tokens;
+    private int[] rows;
+    private int[] columns;
+    private int size;
     private String endLineCharacter;
+    private Features features;
 
     //Constructor
     public Line () {
-        content = new ArrayList<>();
+        tokenTable = TokenTable.getInstance();
+        tokens = new int[8];
+        rows = new int[8];
+        columns = new int[8];
+        size = 0;
         endLineCharacter = "";
+        features = new Features();
     }
 
     //Methods
-    public List<ParseTree> getContent () {
-        return content;
+    public int size () {
+        return size;
+    }
+
+    public boolean isEmpty () {
+        return size == 0;
+    }
+
+    public int getToken (int index) {
+        check(index);
+        return tokens[index];
+    }
+
+    public String getText (int index) {
+        return tokenTable.getText(getToken(index));
+    }
+
+    public int getRow (int index) {
+        check(index);
+        return rows[index];
+    }
+
+    public int getColumn (int index) {
+        check(index);
+        return columns[index];
+    }
+
+    public void add (String text, int row, int column) {
+        add(tokenTable.intern(text), row, column);
+    }
+
+    public void add (int token, int row, int column) {
+        if (size == tokens.length) {
+            tokens = Arrays.copyOf(tokens, size * 2);
+            rows = Arrays.copyOf(rows, size * 2);
+            columns = Arrays.copyOf(columns, size * 2);
+        }
+        tokens[size] = token;
+        rows[size] = row;
+        columns[size] = column;
+        size++;
+    }
+
+    public void append (Line line, int index) {
+        add(line.getToken(index), line.getRow(index), line.getColumn(index));
+    }
+
+    public void remove (int index) {
+        check(index);
+        System.arraycopy(tokens, index + 1, tokens, index, size - index - 1);
+        System.arraycopy(rows, index + 1, rows, index, size - index - 1);
+        System.arraycopy(columns, index + 1, columns, index, size - index - 1);
+        size--;
     }
 
     public void setEndLineCharacter (String endLineCharacter) {
@@ -29,7 +89,30 @@ public class Line {
         return endLineCharacter;
     }
 
+    public Features getFeatures () {
+        return features;
+    }
+
+    public void setFeatures (Features features) {
+        this.features = features;
+    }
+
     public boolean isEqual(Line line) {
-        return line.getEndLineCharacter().equals(this.endLineCharacter) && line.getContent().equals(this.content);
+        if (!line.getEndLineCharacter().equals(this.endLineCharacter) || line.size() != this.size) {
+            return false;
+        }
+        for (int i = 0; i < size; i++) {
+            if (line.getToken(i) != tokens[i] || line.getRow(i) != rows[i] || line.getColumn(i) != columns[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //Private Methods
+    private void check (int index) {
+        if (index < 0 || index >= size) {
+            throw new IndexOutOfBoundsException("Index: " + index + ", Size: " + size);
+        }
     }
 }
@@ -0,0 +1,5 @@
+package global.tools;
+
+public enum Checker {
+    BDD, BMC, AUTO
+}
@@ -0,0 +1,217 @@
+package global.tools;
+
+import java.util.Arrays;
+
+public class Configuration {
+    //Attributes
+    private static Configuration uniqueInstance;
+    private boolean lexerOnly;
+    private int maxInlineDepth;
+    private int maxInlinedStates;
+    private int maxTransitions;
+    private boolean groupedNext;
+    private boolean integerState;
+    private Checker checker;
+    private int bmcThreshold;
+    private boolean slicing;
+    private boolean compositional;
+    private int workers;
+    private int checkWorkers;
+    private int queueCapacity;
+    private int sessionTimeout;
+    private IoMode ioMode;
+    private String persist;
+    private boolean gzip;
+
+    //Constructor
+    private Configuration () {
+        lexerOnly = Boolean.getBoolean("singularity.lexerOnly");
+        maxInlineDepth = Integer.getInteger("singularity.maxInlineDepth", 32);
+        maxInlinedStates = Integer.getInteger("singularity.maxInlinedStates", 50000);
+        maxTransitions = Integer.getInteger("singularity.maxTransitions", 200000);
+        groupedNext = Boolean.getBoolean("singularity.groupedNext");
+        integerState = Boolean.getBoolean("singularity.integerState");
+        checker = getEnum("singularity.checker", Checker.class, Checker.BDD);
+        bmcThreshold = Integer.getInteger("singularity.bmcThreshold", 5000);
+        slicing = Boolean.getBoolean("singularity.slicing");
+        compositional = Boolean.getBoolean("singularity.compositional");
+        workers = Integer.getInteger("singularity.workers", Runtime.getRuntime().availableProcessors());
+        checkWorkers = Integer.getInteger("singularity.checkWorkers", workers);
+        queueCapacity = Integer.getInteger("singularity.queueCapacity", 4);
+        sessionTimeout = Integer.getInteger("singularity.sessionTimeout", 300);
+        ioMode = getEnum("singularity.io", IoMode.class, IoMode.FILE);
+        persist = System.getProperty("singularity.persist", "xml,smv,counterexample,statistics");
+        gzip = Boolean.getBoolean("singularity.gzip");
+    }
+
+    //Methods
+    public static Configuration getInstance () {
+        if (uniqueInstance == null) {
+            uniqueInstance = new Configuration();
+        }
+        return uniqueInstance;
+    }
+
+    public boolean isLexerOnly () {
+        return lexerOnly;
+    }
+
+    public void setLexerOnly (boolean lexerOnly) {
+        this.lexerOnly = lexerOnly;
+    }
+
+    public int getMaxInlineDepth () {
+        return maxInlineDepth;
+    }
+
+    public void setMaxInlineDepth (int maxInlineDepth) {
+        this.maxInlineDepth = maxInlineDepth;
+    }
+
+    public int getMaxInlinedStates () {
+        return maxInlinedStates;
+    }
+
+    public void setMaxInlinedStates (int maxInlinedStates) {
+        this.maxInlinedStates = maxInlinedStates;
+    }
+
+    public int getMaxTransitions () {
+        return maxTransitions;
+    }
+
+    public void setMaxTransitions (int maxTransitions) {
+        this.maxTransitions = maxTransitions;
+    }
+
+    public boolean isGroupedNext () {
+        return groupedNext;
+    }
+
+    public void setGroupedNext (boolean groupedNext) {
+        this.groupedNext = groupedNext;
+    }
+
+    public boolean isIntegerState () {
+        return integerState;
+    }
+
+    public void setIntegerState (boolean integerState) {
+        this.integerState = integerState;
+    }
+
+    public Checker getChecker () {
+        return checker;
+    }
+
+    public void setChecker (Checker checker) {
+        this.checker = checker;
+    }
+
+    //Number of active states above which AUTO picks bounded model checking
+    public int getBmcThreshold () {
+        return bmcThreshold;
+    }
+
+    public void setBmcThreshold (int bmcThreshold) {
+        this.bmcThreshold = bmcThreshold;
+    }
+
+    public boolean isSlicing () {
+        return slicing;
+    }
+
+    public void setSlicing (boolean slicing) {
+        this.slicing = slicing;
+    }
+
+    //Takes precedence over slicing when both are set
+    public boolean isCompositional () {
+        return compositional;
+    }
+
+    public void setCompositional (boolean compositional) {
+        this.compositional = compositional;
+    }
+
+    //Most NuSMV processes running at once, over the parts of a file and the files of a batch
+    public int getWorkers () {
+        return workers;
+    }
+
+    public void setWorkers (int workers) {
+        this.workers = workers;
+    }
+
+    //Files a batch checks at the same time while the next ones are parsed and generated
+    public int getCheckWorkers () {
+        return checkWorkers;
+    }
+
+    public void setCheckWorkers (int checkWorkers) {
+        this.checkWorkers = checkWorkers;
+    }
+
+    //Files a batch stage may have waiting for the next one before it blocks
+    public int getQueueCapacity () {
+        return queueCapacity;
+    }
+
+    public void setQueueCapacity (int queueCapacity) {
+        this.queueCapacity = queueCapacity;
+    }
+
+    //Seconds a NuSMV session may spend on one model before it is killed
+    public int getSessionTimeout () {
+        return sessionTimeout;
+    }
+
+    public void setSessionTimeout (int sessionTimeout) {
+        this.sessionTimeout = sessionTimeout;
+    }
+
+    //I/O mode and persisted files of a run that does not ask for its own
+    public Output getOutput () {
+        return new Output(ioMode, persist);
+    }
+
+    public IoMode getIoMode () {
+        return ioMode;
+    }
+
+    public void setIoMode (IoMode ioMode) {
+        this.ioMode = ioMode;
+    }
+
+    public String getPersist () {
+        return persist;
+    }
+
+    public void setPersist (String persist) {
+        this.persist = persist;
+    }
+
+    //Persisted xml is written as <file>.xml.gz
+    public boolean isGzip () {
+        return gzip;
+    }
+
+    public void setGzip (boolean gzip) {
+        this.gzip = gzip;
+    }
+
+    //Private Methods
+    //Like Integer.getInteger, an unknown value falls back to the default instead of failing
+    private static <T extends Enum<T>> T getEnum (String key, Class<T> type, T fallback) {
+        String value = System.getProperty(key);
+        if (value == null) {
+            return fallback;
+        }
+        try {
+            return Enum.valueOf(type, value.trim().toUpperCase());
+        } catch (IllegalArgumentException exception) {
+            System.err.println("Warning: " + key + "=" + value + " is not one of " + Arrays.toString(type.getEnumConstants()) + ", using " + fallback);
+            return fallback;
+        }
+    }
+}
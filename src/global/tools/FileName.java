@@ -26,6 +26,12 @@ public class FileName {
         return fileName;
     }
 
+    public FileName copy () {
+        FileName copy = new FileName();
+        copy.fileName = fileName;
+        return copy;
+    }
+
     public void reset () {
         fileName = "";
     }
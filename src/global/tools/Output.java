@@ -0,0 +1,34 @@
+package global.tools;
+
+import java.util.Arrays;
+import java.util.HashSet;
+import java.util.Set;
+
+public class Output {
+    //Attributes
+    private IoMode ioMode;
+    private Set<String> persist;
+
+    //Constructor
+    //Persist is a comma separated list of the files ("xml", "smv", "counterexample", "statistics")
+    //a run writes
+    public Output (IoMode ioMode, String persist) {
+        this.ioMode = ioMode;
+        this.persist = new HashSet<>(Arrays.asList(persist.toLowerCase().split("\\s*,\\s*")));
+    }
+
+    //Methods
+    //How the model reaches NuSMV: a file next to the source, NuSMV's standard input, or a file
+    //in an in-memory filesystem
+    public IoMode getIoMode () {
+        return ioMode;
+    }
+
+    public boolean persists (String artifact) {
+        return persist.contains(artifact);
+    }
+
+    public String getPersist () {
+        return String.join(",", persist);
+    }
+}
@@ -21,6 +21,16 @@ public class Statistics {
     private int smallestCounterexample;
     private int usedStates;
     private int usedtransitions;
+    private int rejectedCalls;
+    private int cutCalls;
+    private int bound;
+    private long dfaHits;
+    private long dfaMisses;
+    private boolean llFallback;
+    private int batchParses;
+    private int batchFallbacks;
+    private long batchDfaHits;
+    private long batchDfaMisses;
 
     //Constructor
     private Statistics () {
@@ -36,6 +46,45 @@ public class Statistics {
         return uniqueInstance;
     }
 
+    //Snapshot of the counters and the file name, so a file can be reported while the next one
+    //is already being counted
+    public Statistics copy () {
+        Statistics copy = new Statistics();
+        copy.fileName = fileName.copy();
+        copy.states = states;
+        copy.eventTransitions = eventTransitions;
+        copy.stateTransitions = stateTransitions;
+        copy.events = events;
+        copy.decisions = decisions;
+        copy.components = components;
+        copy.properties = properties;
+        copy.propertiesCaseOne = propertiesCaseOne;
+        copy.propertiesCaseTwo = propertiesCaseTwo;
+        copy.propertiesCaseThree = propertiesCaseThree;
+        copy.totalCounterexamples = totalCounterexamples;
+        copy.validCounterexamples = validCounterexamples;
+        copy.invalidCounterexamples = invalidCounterexamples;
+        copy.biggestCounterexample = biggestCounterexample;
+        copy.smallestCounterexample = smallestCounterexample;
+        copy.usedStates = usedStates;
+        copy.usedtransitions = usedtransitions;
+        copy.rejectedCalls = rejectedCalls;
+        copy.cutCalls = cutCalls;
+        copy.bound = bound;
+        copy.dfaHits = dfaHits;
+        copy.dfaMisses = dfaMisses;
+        copy.llFallback = llFallback;
+        copy.batchParses = batchParses;
+        copy.batchFallbacks = batchFallbacks;
+        copy.batchDfaHits = batchDfaHits;
+        copy.batchDfaMisses = batchDfaMisses;
+        return copy;
+    }
+
+    public String getFileName () {
+        return fileName.getFileName();
+    }
+
     public int getStates () {
         return states;
     }
@@ -160,10 +209,31 @@ public class Statistics {
         this.smallestCounterexample = smallestCounterexample;
     }
 
+    public int getRejectedCalls () {
+        return rejectedCalls;
+    }
+
+    public void addRejectedCall () {
+        rejectedCalls ++;
+    }
+
+    public int getCutCalls () {
+        return cutCalls;
+    }
+
+    public void addCutCall () {
+        cutCalls ++;
+    }
+
     public int getComplexity () {
         return stateTransitions - states + 2 * components;
     }
 
+    //Bound given to the BMC engine, -1 when the BDD engine checks the model
+    public void setBound (int bound) {
+        this.bound = bound;
+    }
+
     public void setUsedStates (int usedStates) {
         this.usedStates = usedStates;
     }
@@ -172,6 +242,38 @@ public class Statistics {
         this.usedtransitions = usedtransitions;
     }
 
+    //Parser counters are kept per file and, until resetBatch is called, for the whole batch
+    public void addParse (boolean llFallback, long dfaHits, long dfaMisses) {
+        this.llFallback = llFallback;
+        this.dfaHits = dfaHits;
+        this.dfaMisses = dfaMisses;
+        batchParses ++;
+        if (llFallback) {
+            batchFallbacks ++;
+        }
+        batchDfaHits += dfaHits;
+        batchDfaMisses += dfaMisses;
+    }
+
+    public double getDfaHitRate () {
+        return rate(dfaHits, dfaHits + dfaMisses);
+    }
+
+    public double getBatchDfaHitRate () {
+        return rate(batchDfaHits, batchDfaHits + batchDfaMisses);
+    }
+
+    public double getBatchFallbackRate () {
+        return rate(batchFallbacks, batchParses);
+    }
+
+    public void resetBatch () {
+        batchParses = 0;
+        batchFallbacks = 0;
+        batchDfaHits = 0;
+        batchDfaMisses = 0;
+    }
+
     public String print () {
         String header = "";
 
@@ -183,13 +285,19 @@ public class Statistics {
         header = header.concat("Number of event transitions: " + eventTransitions + "\n");
         header = header.concat("Number of total transitions: " + getTotalTransitions() + "\n");
         header = header.concat("Number of components: " + components + "\n");
+        header = header.concat("Number of rejected call candidates: " + rejectedCalls + "\n");
+        header = header.concat("Number of calls cut off by inlining limits: " + cutCalls + "\n");
         header = header.concat("..................................\n");
         header = header.concat("Cyclomatic Complexity: " + getComplexity() + "\n");
         header = header.concat("..................................\n");
+        header = header.concat("DFA cache hit rate: " + String.format("%.2f", getDfaHitRate()) + "% (batch: " + String.format("%.2f", getBatchDfaHitRate()) + "%)\n");
+        header = header.concat("Parsed with LL fallback: " + (llFallback ? "yes" : "no") + " (batch: " + batchFallbacks + " of " + batchParses + ", " + String.format("%.2f", getBatchFallbackRate()) + "%)\n");
+        header = header.concat("..................................\n");
         header = header.concat("Number of Case One properties: " + propertiesCaseOne + "\n");
         header = header.concat("Number of Case Two properties: " + propertiesCaseTwo + "\n");
         header = header.concat("Number of Case Three properties: " + propertiesCaseThree + "\n");
         header = header.concat("Total Number of properties: " + properties + "\n");
+        header = header.concat("Model checking engine: " + (bound == -1 ? "BDD" : "BMC (bound " + bound + ")") + "\n");
         header = header.concat("..................................\n");
         header = header.concat("Number of Counterexamples: " + totalCounterexamples + "\n");
         header = header.concat("Number of Valid Counterexamples: " + validCounterexamples + "\n");
@@ -245,5 +353,19 @@ public class Statistics {
         smallestCounterexample = 0;
         usedStates = 0;
         usedtransitions = 0;
+        rejectedCalls = 0;
+        cutCalls = 0;
+        bound = -1;
+        dfaHits = 0;
+        dfaMisses = 0;
+        llFallback = false;
+    }
+
+    //Private Methods
+    private double rate (long part, long total) {
+        if (total == 0) {
+            return 0;
+        }
+        return 100.0 * part / total;
     }
 }
@@ -0,0 +1,98 @@
+package global.tools;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+public class TokenTable {
+    //Keywords, registered first so their ids are fixed
+    public static final int CLASS = 0;
+    public static final int STRUCT = 1;
+    public static final int NAMESPACE = 2;
+    public static final int FOR = 3;
+    public static final int DO = 4;
+    public static final int WHILE = 5;
+    public static final int SWITCH = 6;
+    public static final int IF = 7;
+    public static final int ELSE = 8;
+    public static final int TRY = 9;
+    public static final int CATCH = 10;
+    public static final int TILDE = 11;
+    public static final int RETURN = 12;
+    public static final int BREAK = 13;
+    public static final int CONTINUE = 14;
+    public static final int ASSIGN = 15;
+    public static final int CASE = 16;
+    public static final int DEFAULT = 17;
+    public static final int THROW = 18;
+    public static final int PUBLIC = 19;
+    public static final int PRIVATE = 20;
+    public static final int OPEN_PARENTHESIS = 21;
+    public static final int CLOSE_PARENTHESIS = 22;
+    public static final int OPEN_BRACE = 23;
+    public static final int CLOSE_BRACE = 24;
+    public static final int COLON = 25;
+    public static final int SEMICOLON = 26;
+    public static final int DOT = 27;
+    public static final int ARROW = 28;
+    public static final int SCOPE = 29;
+    public static final int STD = 30;
+    public static final int COUT = 31;
+    public static final int ENDL = 32;
+    public static final int SHIFT_LEFT = 33;
+    public static final int COMMA = 34;
+    public static final int ELLIPSIS = 35;
+    public static final int VOID = 36;
+    public static final int LESS = 37;
+    public static final int GREATER = 38;
+    public static final int SHIFT_RIGHT = 39;
+    private static final String[] KEYWORDS = {
+            "class", "struct", "namespace", "for", "do", "while", "switch", "if", "else", "try", "catch", "~",
+            "return", "break", "continue", "=", "case", "default", "throw", "public", "private",
+            "(", ")", "{", "}", ":", ";", ".", "->", "::", "std", "cout", "endl", "<<",
+            ",", "...", "void", "<", ">", ">>"
+    };
+
+    //Attributes
+    private static TokenTable uniqueInstance;
+    private Map<String, Integer> ids;
+    private List<String> texts;
+
+    //Constructor
+    private TokenTable () {
+        ids = new HashMap<>();
+        texts = new ArrayList<>();
+        for (String keyword : KEYWORDS) {
+            intern(keyword);
+        }
+    }
+
+    //Methods
+    public static TokenTable getInstance () {
+        if (uniqueInstance == null) {
+            uniqueInstance = new TokenTable();
+        }
+        return uniqueInstance;
+    }
+
+    //Starts an empty table for the next file. Lines already built keep the table they were made
+    //with, so identifiers are only held as long as the states that use them
+    public static void renew () {
+        uniqueInstance = new TokenTable();
+    }
+
+    public int intern (String text) {
+        Integer id = ids.get(text);
+        if (id == null) {
+            id = texts.size();
+            ids.put(text, id);
+            texts.add(text);
+        }
+        return id;
+    }
+
+    public String getText (int id) {
+        return texts.get(id);
+    }
+}
@@ -0,0 +1,46 @@
+package reader;
+
+import org.antlr.v4.runtime.Parser;
+import org.antlr.v4.runtime.atn.ATN;
+import org.antlr.v4.runtime.atn.ParserATNSimulator;
+import org.antlr.v4.runtime.atn.PredictionContextCache;
+import org.antlr.v4.runtime.dfa.DFA;
+import org.antlr.v4.runtime.dfa.DFAState;
+
+public class CountingSimulator extends ParserATNSimulator {
+    //Attributes
+    private long hits;
+    private long misses;
+
+    //Constructor
+    public CountingSimulator (Parser parser, ATN atn, DFA[] decisionToDFA, PredictionContextCache sharedContextCache) {
+        super(parser, atn, decisionToDFA, sharedContextCache);
+        hits = 0;
+        misses = 0;
+    }
+
+    //Methods
+    @Override
+    protected DFAState getExistingTargetState (DFAState previousD, int t) {
+        DFAState target = super.getExistingTargetState(previousD, t);
+        if (target == null) {
+            misses++;
+        } else {
+            hits++;
+        }
+        return target;
+    }
+
+    public long getHits () {
+        return hits;
+    }
+
+    public long getMisses () {
+        return misses;
+    }
+
+    public void resetCounters () {
+        hits = 0;
+        misses = 0;
+    }
+}
@@ -0,0 +1,88 @@
+package reader;
+
+import global.tools.Statistics;
+import org.antlr.v4.runtime.*;
+import org.antlr.v4.runtime.atn.PredictionMode;
+import org.antlr.v4.runtime.misc.ParseCancellationException;
+import org.antlr.v4.runtime.tree.ParseTree;
+
+import java.io.IOException;
+
+public class StagedReader {
+    //Attributes
+    private CPP14Lexer lexer;
+    private CPP14Parser parser;
+    private CountingSimulator simulator;
+    private Statistics statistics;
+    private String error;
+    private ANTLRErrorListener listener;
+
+    //Constructor
+    //The lexer and parser are created once and reused, so the DFA cache their simulators
+    //share keeps warming up across every file of a batch. They drop the input after each
+    //parse, leaving the returned tree as the only reference to the file's tokens
+    public StagedReader () {
+        lexer = new CPP14Lexer(null);
+        parser = new CPP14Parser(null);
+        simulator = new CountingSimulator(parser, parser.getATN(), parser.getInterpreter().decisionToDFA, parser.getInterpreter().getSharedContextCache());
+        parser.setInterpreter(simulator);
+        statistics = Statistics.getInstance();
+        listener = new BaseErrorListener() {
+            @Override
+            public void syntaxError (Recognizer<?, ?> recognizer, Object offendingSymbol, int line, int charPositionInLine, String msg, RecognitionException e) {
+                if (error == null) {
+                    error = "line " + line + ":" + charPositionInLine + " " + msg;
+                }
+            }
+        };
+        lexer.removeErrorListeners();
+        lexer.addErrorListener(listener);
+    }
+
+    //Public Methods
+    public ParseTree read (String input) throws IOException {
+        return read(CharStreams.fromFileName(input));
+    }
+
+    //Returns null when the input is not valid C++, with the first syntax error left in getError
+    public ParseTree read (CharStream charStream) {
+        error = null;
+        lexer.setInputStream(charStream);
+        CommonTokenStream tokens = new CommonTokenStream(lexer);
+        parser.setTokenStream(tokens);
+        simulator.resetCounters();
+
+        ParseTree parseTree;
+        boolean fallback = false;
+        try {
+            parseTree = parse(PredictionMode.SLL, new BailErrorStrategy(), null);
+        } catch (ParseCancellationException exception) {
+            fallback = true;
+            parser.reset();
+            parseTree = parse(PredictionMode.LL, new DefaultErrorStrategy(), listener);
+        }
+
+        statistics.addParse(fallback, simulator.getHits(), simulator.getMisses());
+        parser.setTokenStream(null);
+        lexer.setInputStream(null);
+        if (error != null) {
+            return null;
+        }
+        return parseTree;
+    }
+
+    public String getError () {
+        return error;
+    }
+
+    //Private Methods
+    private ParseTree parse (PredictionMode mode, ANTLRErrorStrategy strategy, ANTLRErrorListener listener) {
+        simulator.setPredictionMode(mode);
+        parser.setErrorHandler(strategy);
+        parser.removeErrorListeners();
+        if (listener != null) {
+            parser.addErrorListener(listener);
+        }
+        return parser.translationunit();
+    }
+}
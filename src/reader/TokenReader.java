@@ -0,0 +1,70 @@
+package reader;
+
+import org.antlr.v4.runtime.*;
+
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.List;
+
+public class TokenReader {
+    //Attributes
+    private boolean lexerError;
+
+    //Constructor
+    public TokenReader () {
+        lexerError = false;
+    }
+
+    //Public Methods
+    public List<Token> read (String input) throws IOException {
+        return read(CharStreams.fromFileName(input));
+    }
+
+    //Returns the tokens in the same order the parse tree leaves would have, or null when
+    //the stream does not look well formed and the full parser has to be used instead
+    public List<Token> read (CharStream charStream) {
+        lexerError = false;
+        CPP14Lexer lexer = new CPP14Lexer(charStream);
+        lexer.removeErrorListeners();
+        lexer.addErrorListener(new BaseErrorListener() {
+            @Override
+            public void syntaxError (Recognizer<?, ?> recognizer, Object offendingSymbol, int line, int charPositionInLine, String msg, RecognitionException e) {
+                lexerError = true;
+            }
+        });
+
+        List<Token> tokens = new ArrayList<>();
+        int braces = 0;
+        int parentheses = 0;
+        Token token;
+        do {
+            token = lexer.nextToken();
+            if (token.getChannel() != Token.DEFAULT_CHANNEL) {
+                continue;
+            }
+            switch (token.getText()) {
+                case "{" :
+                    braces++;
+                    break;
+                case "}" :
+                    braces--;
+                    break;
+                case "(" :
+                    parentheses++;
+                    break;
+                case ")" :
+                    parentheses--;
+                    break;
+            }
+            if (braces < 0 || parentheses < 0) {
+                return null;
+            }
+            tokens.add(token);
+        } while (token.getType() != Token.EOF);
+
+        if (lexerError || braces != 0 || parentheses != 0) {
+            return null;
+        }
+        return tokens;
+    }
+}
@@ -1,8 +1,19 @@
+import constructor.Result;
+import global.tools.Configuration;
+import org.junit.Assert;
 import org.junit.Before;
 import org.junit.Test;
 
 import java.io.BufferedReader;
+import java.io.IOException;
 import java.io.InputStreamReader;
+import java.io.OutputStreamWriter;
+import java.io.Writer;
+import java.nio.file.Files;
+import java.nio.file.Paths;
+import java.util.Arrays;
+import java.util.HashSet;
+import java.util.Set;
 import java.util.concurrent.TimeUnit;
 
 public class SingularityTest {
@@ -26,6 +37,51 @@ public class SingularityTest {
         singularity.run("test/data/triangle.cpp", false);
     }
 
+    @Test
+    public void lexerOnly() {
+        Configuration.getInstance().setLexerOnly(true);
+        System.out.println("\n          MINIMAL (LEXER ONLY)\n");
+        singularity.run("test/data/minimal.cpp", false);
+        System.out.println("\n          TRIANGLE (LEXER ONLY)\n");
+        singularity.run("test/data/triangle.cpp", false);
+        Configuration.getInstance().setLexerOnly(false);
+    }
+
+    //Every name in the .ord file has to be a bit NuSMV created for the model
+    @Test
+    public void integerStateOrdering() throws IOException {
+        Configuration.getInstance().setIntegerState(true);
+        singularity.run("test/data/minimal.cpp", false);
+        Configuration.getInstance().setIntegerState(false);
+
+        Process process = Runtime.getRuntime().exec("./NuSMV -int");
+        Writer writer = new OutputStreamWriter(process.getOutputStream());
+        writer.write("read_model -i test/data/minimal.smv\nflatten_hierarchy\nencode_variables\nshow_vars -b\nquit\n");
+        writer.close();
+        Set<String> bits = new HashSet<>();
+        BufferedReader reader = new BufferedReader(new InputStreamReader(process.getInputStream()));
+        String line;
+        while ((line = reader.readLine()) != null) {
+            bits.addAll(Arrays.asList(line.trim().split("[\\s:]+")));
+        }
+        for (String name : Files.readAllLines(Paths.get("test/data/minimal.ord"))) {
+            Assert.assertTrue(name, bits.contains(name));
+        }
+    }
+
+    @Test
+    public void inMemory() throws IOException {
+        System.out.println("\n          MINIMAL (IN MEMORY)\n");
+        Result result = singularity.analyzeFile("test/data/minimal.cpp", false);
+        System.out.println(result.getReport());
+    }
+
+    @Test
+    public void pipeline() {
+        System.out.println("\n          MCCABE (PIPELINE)\n");
+        singularity.run(Arrays.asList("test/McCabe/case01.cpp", "test/McCabe/case02.cpp", "test/McCabe/case03.cpp"), false, result -> System.out.println(result.getReport()));
+    }
+
     @Test
     public void McCabe() {
         System.out.println("\n          CASE 01\n");